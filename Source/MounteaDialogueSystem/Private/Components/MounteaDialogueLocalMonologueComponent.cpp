@@ -28,8 +28,9 @@
 #include "Interfaces/Nodes/MounteaDialogueSpeechDataInterface.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
 #include "Subsystem/MounteaDialogueLocalMonologueSubsystem.h"
-#include "TimerManager.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 UMounteaDialogueLocalMonologueComponent::UMounteaDialogueLocalMonologueComponent()
 {
@@ -172,12 +173,11 @@ bool UMounteaDialogueLocalMonologueComponent::StartLocalMonologueInternal(const
 	tempContext->SessionGUID = FGuid::NewGuid();
 	tempContext->DialogueParticipants = allParticipants;
 
-	TArray<UMounteaDialogueGraphNode*> filteredChildren =
-		UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(firstRuntimeNode, tempContext);
-	UMounteaDialogueTraversalStatics::SortNodes(filteredChildren);
+	FMounteaDialogueNodeBuffer filteredChildren;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(firstRuntimeNode, tempContext, filteredChildren, true);
 
 	tempContext->SetDialogueContext(firstRuntimeNode, filteredChildren);
-	tempContext->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(firstRuntimeNode));
+	tempContext->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(firstRuntimeNode));
 	tempContext->UpdateActiveDialogueRowDataIndex(0);
 
 	TScriptInterface<IMounteaDialogueParticipantInterface> initialActiveParticipant = mainParticipant;
@@ -247,8 +247,8 @@ void UMounteaDialogueLocalMonologueComponent::RequestStartDialogue_Implementatio
 
 void UMounteaDialogueLocalMonologueComponent::RequestCloseDialogue_Implementation()
 {
-	if (UWorld* world = GetWorld())
-		world->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->ClearDialogueTimer(TimerHandle_RowTimer);
 
 	SetManagerState(DefaultManagerState);
 }
@@ -273,7 +273,10 @@ void UMounteaDialogueLocalMonologueComponent::CloseDialogue_Implementation()
 	Execute_CleanupDialogue(this);
 
 	if (IsValid(DialogueContext))
+	{
 		DialogueContext->TraversedPath.Empty();
+		DialogueContext->MarkConditionStateChanged();
+	}
 
 	SetDialogueContext(nullptr);
 
@@ -360,12 +363,11 @@ void UMounteaDialogueLocalMonologueComponent::ProcessNode_Implementation()
 		return;
 	}
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes =
-		UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(dialogueContext->ActiveNode, dialogueContext);
-	UMounteaDialogueTraversalStatics::SortNodes(allowedChildrenNodes);
+	FMounteaDialogueNodeBuffer allowedChildrenNodes;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(dialogueContext->ActiveNode, dialogueContext, allowedChildrenNodes, true);
 
 	dialogueContext->UpdateAllowedChildrenNodes(allowedChildrenNodes);
-	dialogueContext->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(processingNode));
+	dialogueContext->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(processingNode));
 	dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 	OnDialogueContextUpdated.Broadcast(dialogueContext);
 
@@ -402,9 +404,8 @@ void UMounteaDialogueLocalMonologueComponent::NodeProcessed_Implementation()
 	OnDialogueNodeFinished.Broadcast(dialogueContext);
 	dialogueContext->ActiveNode->CleanupNode();
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes =
-		UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(dialogueContext->ActiveNode, dialogueContext);
-	UMounteaDialogueTraversalStatics::SortNodes(allowedChildrenNodes);
+	FMounteaDialogueNodeBuffer allowedChildrenNodes;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(dialogueContext->ActiveNode, dialogueContext, allowedChildrenNodes, true);
 
 	UMounteaDialogueGraphNode* newActiveNode = nullptr;
 	for (UMounteaDialogueGraphNode* childNode : allowedChildrenNodes)
@@ -452,14 +453,14 @@ void UMounteaDialogueLocalMonologueComponent::ProcessDialogueRow_Implementation(
 		return;
 
 	const int32 activeIndex = dialogueContext->GetActiveDialogueRowDataIndex();
-	const FDialogueRow row = dialogueContext->GetActiveDialogueRow();
+	const FDialogueRow& row = dialogueContext->ActiveDialogueRow;
 	if (!row.RowData.IsValidIndex(activeIndex))
 	{
 		Execute_DialogueRowProcessed(this, false);
 		return;
 	}
 
-	const FDialogueRowData rowData = row.RowData[activeIndex];
+	const FDialogueRowData& rowData = row.RowData[activeIndex];
 	if (!UMounteaDialogueTraversalStatics::IsDialogueRowDataValid(rowData))
 	{
 		Execute_DialogueRowProcessed(this, false);
@@ -478,11 +479,11 @@ void UMounteaDialogueLocalMonologueComponent::ProcessDialogueRow_Implementation(
 
 	FTimerDelegate rowDelegate;
 	rowDelegate.BindUObject(this, &UMounteaDialogueLocalMonologueComponent::DialogueRowProcessed_Implementation, false);
-	world->GetTimerManager().SetTimer(
-		TimerHandle_RowTimer,
-		rowDelegate,
-		UMounteaDialogueTraversalStatics::GetRowDuration(rowData),
-		false);
+	if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
+	{
+		subsystem->ClearDialogueTimer(TimerHandle_RowTimer);
+		TimerHandle_RowTimer = subsystem->SetDialogueTimer(rowDelegate, UMounteaDialogueTraversalStatics::GetActiveRowDuration(dialogueContext));
+	}
 }
 
 void UMounteaDialogueLocalMonologueComponent::DialogueRowProcessed_Implementation(const bool bForceFinish)
@@ -504,7 +505,8 @@ void UMounteaDialogueLocalMonologueComponent::DialogueRowProcessed_Implementatio
 		return;
 	}
 
-	world->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
+		subsystem->ClearDialogueTimer(TimerHandle_RowTimer);
 
 	const FMounteaDialogueRowDataInfo rowInfo = GetDialogueRowDataInfo(dialogueContext);
 
@@ -742,7 +744,16 @@ UMounteaDialogueGraph* UMounteaDialogueLocalMonologueComponent::ResolveActiveDia
 
 	if (!Request.DialogueGraph.IsNull())
 	{
-		UMounteaDialogueGraph* graphOverride = Request.DialogueGraph.LoadSynchronous();
+		UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+		UMounteaDialogueGraph* graphOverride = graphRegistry ? graphRegistry->FindGraphByAsset(Request.DialogueGraph) : Request.DialogueGraph.Get();
+		if (!IsValid(graphOverride))
+		{
+			// Local start has no async path, keep the old behaviour for Graphs nobody preloaded
+			LOG_WARNING(TEXT("[ResolveActiveDialogueGraph] DialogueGraph override '%s' is not resident, loading synchronously."), *Request.DialogueGraph.ToString())
+			graphOverride = Request.DialogueGraph.LoadSynchronous();
+			if (graphRegistry)
+				graphRegistry->RegisterGraph(graphOverride);
+		}
 		if (!IsValid(graphOverride))
 		{
 			OutErrorMessage = TEXT("[ResolveActiveDialogueGraph] DialogueGraph override is set but failed to load.");
@@ -759,6 +770,9 @@ UMounteaDialogueGraph* UMounteaDialogueLocalMonologueComponent::ResolveActiveDia
 		return nullptr;
 	}
 
+	if (UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this))
+		graphRegistry->RegisterGraph(participantGraph);
+
 	return participantGraph;
 }
 
@@ -769,12 +783,11 @@ void UMounteaDialogueLocalMonologueComponent::ApplyNodeSwitchForLinearMonologue(
 	if (!IsValid(Context) || !IsValid(NewActiveNode))
 		return;
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildNodes =
-		UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(NewActiveNode, Context);
-	UMounteaDialogueTraversalStatics::SortNodes(allowedChildNodes);
+	FMounteaDialogueNodeBuffer allowedChildNodes;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(NewActiveNode, Context, allowedChildNodes, true);
 
 	Context->SetDialogueContext(NewActiveNode, allowedChildNodes);
-	Context->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(NewActiveNode));
+	Context->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(NewActiveNode));
 	Context->UpdateActiveDialogueRowDataIndex(0);
 
 	const TScriptInterface<IMounteaDialogueParticipantInterface> newActiveParticipant =
@@ -12,6 +12,8 @@
 #include "Components/MounteaDialogueManager.h"
 
 #include "TimerManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
 #include "Graph/MounteaDialogueGraph.h"
 
 #include "Data/MounteaDialogueContext.h"
@@ -23,6 +25,7 @@
 #include "Helpers/MounteaDialogueParticipantStatics.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Serialization/BitWriter.h"
 #include "Components/MounteaDialogueSession.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
 #include "Subsystem/MounteaDialogueWorldSubsystem.h"
@@ -77,6 +80,9 @@ void UMounteaDialogueManager::BeginPlay()
 
 void UMounteaDialogueManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UISignalFlushHandle.IsValid())
+		FlushUISignals(GetWorld(), LEVELTICK_All, 0.f);
+
 	Super::EndPlay(EndPlayReason);
 	
 	OnDialogueStartRequestedResult.Clear();
@@ -119,10 +125,10 @@ FMounteaDialogueRowDataInfo GetDialogueRowDataInfo(const UMounteaDialogueContext
 	const int32 currentIndex = DialogueContext->GetActiveDialogueRowDataIndex();
 	Info.IncreasedIndex = currentIndex + 1;
 
-	const FDialogueRow dialogueRow = DialogueContext->GetActiveDialogueRow();
+	const FDialogueRow& dialogueRow = DialogueContext->GetActiveDialogueRow();
 	Info.bIsActiveRowValid = UMounteaDialogueTraversalStatics::IsDialogueRowValid(dialogueRow);
 
-	const TArray<FDialogueRowData> rowDataArray = DialogueContext->GetActiveDialogueRow().RowData;
+	const TArray<FDialogueRowData>& rowDataArray = dialogueRow.RowData;
 	
 	Info.bDialogueRowDataValid = rowDataArray.IsValidIndex(Info.IncreasedIndex);
 
@@ -162,7 +168,7 @@ void UMounteaDialogueManager::OnRep_ManagerState()
 		UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
 		if (subsystem)
 		{
-			if (UMounteaDialogueSession* session = subsystem->GetGameStateSession())
+			if (UMounteaDialogueSession* session = subsystem->FindSessionForManager(this))
 				session->TryDispatchPendingClientPayload();
 		}
 	}
@@ -219,7 +225,12 @@ void UMounteaDialogueManager::OnContextPayloadUpdated(const FMounteaDialogueCont
 	{
 		DialogueContext->ActiveNode = UMounteaDialogueContextStatics::FindNodeByGUID(activeGraph, Payload.ActiveNodeGUID);
 		DialogueContext->PreviousActiveNode = Payload.PreviousNodeGUID;
-		DialogueContext->AllowedChildNodes = UMounteaDialogueContextStatics::FindNodesByGUID(activeGraph, Payload.AllowedChildNodeGUIDs);
+		DialogueContext->AllowedChildNodes.Reset(Payload.AllowedChildNodeGUIDs.Num());
+		for (const FGuid& allowedChildGUID : Payload.AllowedChildNodeGUIDs)
+		{
+			if (UMounteaDialogueGraphNode* allowedChildNode = UMounteaDialogueContextStatics::FindNodeByGUID(activeGraph, allowedChildGUID))
+				DialogueContext->AllowedChildNodes.Add(allowedChildNode);
+		}
 	}
 	else
 	{
@@ -230,6 +241,7 @@ void UMounteaDialogueManager::OnContextPayloadUpdated(const FMounteaDialogueCont
 
 	DialogueContext->ActiveDialogueRow = Payload.ActiveDialogueRow;
 	DialogueContext->ActiveDialogueRowDataIndex = Payload.ActiveDialogueRowDataIndex;
+	DialogueContext->MarkConditionStateChanged();
 
 	OnDialogueContextUpdated.Broadcast(DialogueContext);
 
@@ -371,13 +383,14 @@ void UMounteaDialogueManager::RequestSelectNode_Server_Implementation(FGuid Sess
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Select Node] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Select Node] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("RequestSelectNode_Server"), 0);
 	session->HandleSelectNode(this, SessionGUID, NodeGUID);
 }
 
@@ -387,13 +400,14 @@ void UMounteaDialogueManager::RequestSkipRow_Server_Implementation(FGuid Session
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Skip Dialogue Row] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Skip Dialogue Row] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("RequestSkipRow_Server"), 0);
 	session->HandleSkipDialogueRow(this, SessionGUID);
 }
 
@@ -403,13 +417,14 @@ void UMounteaDialogueManager::RequestNodeProcessed_Server_Implementation(FGuid S
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Node Processed] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Node Processed] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("RequestNodeProcessed_Server"), 0);
 	session->HandleNodeProcessed(this, SessionGUID);
 }
 
@@ -419,13 +434,14 @@ void UMounteaDialogueManager::RequestDialogueRowProcessed_Server_Implementation(
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("RequestDialogueRowProcessed_Server"), 0);
 	session->HandleDialogueRowProcessed(this, SessionGUID, bForceFinish);
 }
 
@@ -435,19 +451,59 @@ void UMounteaDialogueManager::RequestCloseDialogue_Server_Implementation(FGuid S
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Close Dialogue] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Close Dialogue] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("RequestCloseDialogue_Server"), 0);
 	session->HandleCloseDialogue(this, SessionGUID);
 }
 
+void UMounteaDialogueManager::ReportNodeAddressingMismatch_Server_Implementation(FGuid SessionGUID, FGuid GraphGUID)
+{
+	UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	const AActor* owningActor = GetOwner();
+	if (!subsystem || !owningActor)
+		return;
+
+	// Only the Graph of the running dialogue can be switched to GUID addressing
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
+	if (!session || session->GetContextPayload().SessionGUID != SessionGUID || session->GetContextPayload().ActiveGraphGUID != GraphGUID)
+		return;
+
+	LOG_WARNING(TEXT("[Node Addressing] Client Graph '%s' does not match the server one, falling back to GUID addressing."), *GraphGUID.ToString())
+	subsystem->MarkGuidAddressingRequired(owningActor->GetNetConnection(), GraphGUID);
+
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("ReportNodeAddressingMismatch_Server"), 0);
+	session->ResendNodeReferences();
+}
+
+void UMounteaDialogueManager::ReportUnresolvedDialogueRow_Server_Implementation(FGuid SessionGUID, UDataTable* RowTable)
+{
+	UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	const AActor* owningActor = GetOwner();
+	if (!subsystem || !owningActor || !RowTable)
+		return;
+
+	// Only the Data Table of the running dialogue can be switched to full rows
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
+	if (!session || session->GetContextPayload().SessionGUID != SessionGUID || session->GetContextPayload().ActiveRowTable != RowTable)
+		return;
+
+	LOG_WARNING(TEXT("[Dialogue Row] Client cannot resolve rows of '%s', falling back to full rows."), *GetNameSafe(RowTable))
+	subsystem->MarkFullRowRequired(owningActor->GetNetConnection(), RowTable);
+
+	MOUNTEA_DIALOGUE_SESSION_STATS_RPC(session->GetSessionStats(), TEXT("ReportUnresolvedDialogueRow_Server"), 0);
+	session->ResendActiveDialogueRow();
+}
+
 void UMounteaDialogueManager::RequestCloseDialogue_Implementation()
 {
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->ClearDialogueTimer(TimerHandle_RowTimer);
 
 	if (!UMounteaDialogueManagerStatics::IsServer(GetOwner()))
 	{
@@ -457,7 +513,7 @@ void UMounteaDialogueManager::RequestCloseDialogue_Implementation()
 			UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
 			if (subsystem)
 			{
-				if (UMounteaDialogueSession* session = subsystem->GetGameStateSession())
+				if (UMounteaDialogueSession* session = subsystem->FindSessionForManager(this))
 					sessionGuid = session->GetContextPayload().SessionGUID;
 			}
 		}
@@ -560,7 +616,7 @@ void UMounteaDialogueManager::StartDialogue_Implementation()
 		UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
 		if (subsystem)
 		{
-			if (UMounteaDialogueSession* session = subsystem->GetGameStateSession())
+			if (UMounteaDialogueSession* session = subsystem->FindSessionForManager(this))
 				session->TryDispatchPendingClientPayload();
 		}
 		return;
@@ -569,10 +625,10 @@ void UMounteaDialogueManager::StartDialogue_Implementation()
 	// Server: deliver UI create signal to owning client.
 	{
 		UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-		const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
+		const UMounteaDialogueSession* session = subsystem ? subsystem->FindSessionForManager(this) : nullptr;
 		const FMounteaDialogueContextPayload& payload = session ? session->GetContextPayload() : FMounteaDialogueContextPayload();
 		const FGuid sessionGuid = IsValid(DialogueContext) ? DialogueContext->SessionGUID : FGuid();
-		Client_DispatchUISignal(FMounteaDialogueUISignal{
+		QueueUISignal(FMounteaDialogueUISignal{
 			MounteaDialogueWidgetCommands::CreateDialogueWidget,
 			sessionGuid,
 			payload.ContextVersion,
@@ -587,13 +643,16 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 {
 	const FGuid closingSessionGuid = IsValid(DialogueContext) ? DialogueContext->SessionGUID : FGuid();
 
+	// Session returns to the pool once the lock is released, its payload version is needed for the close signal
+	int32 closingContextVersion = 0;
 	if (UMounteaDialogueManagerStatics::IsServer(GetOwner()))
 	{
 		auto* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
 		if (subsystem)
 		{
-			if (UMounteaDialogueSession* session = subsystem->GetGameStateSession())
+			if (UMounteaDialogueSession* session = subsystem->FindSessionForManager(this))
 			{
+				closingContextVersion = session->GetContextPayload().ContextVersion;
 				session->FinalizeSession();
 			}
 
@@ -601,7 +660,10 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 		}
 
 		if (IsValid(DialogueContext))
+		{
 			DialogueContext->TraversedPath.Empty();
+			DialogueContext->MarkConditionStateChanged();
+		}
 	}
 
 	StopParticipants();
@@ -609,16 +671,13 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 	// Deliver UI close signal to owning client then flush the signal queue.
 	if (UMounteaDialogueManagerStatics::IsServer(GetOwner()))
 	{
-		UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-		const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
-		const FMounteaDialogueContextPayload& payload = session ? session->GetContextPayload() : FMounteaDialogueContextPayload();
-		Client_DispatchUISignal(FMounteaDialogueUISignal{
+		QueueUISignal(FMounteaDialogueUISignal{
 			MounteaDialogueWidgetCommands::CloseDialogueWidget,
 			closingSessionGuid,
-			payload.ContextVersion,
+			closingContextVersion,
 			true
 		});
-		Client_ClearUISignals(closingSessionGuid);
+		QueueClearUISignals(closingSessionGuid);
 	}
 
 	Execute_CleanupDialogue(this);
@@ -634,7 +693,8 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 
 void UMounteaDialogueManager::CleanupDialogue_Implementation()
 {
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->ClearDialogueTimer(TimerHandle_RowTimer);
 	
 	if (!UMounteaDialogueContextStatics::IsContextValid(DialogueContext))
 		return;
@@ -662,6 +722,60 @@ void UMounteaDialogueManager::Client_ClearUISignals_Implementation(const FGuid&
 	OnDialogueUISignalRequested.Broadcast(sentinel);
 }
 
+void UMounteaDialogueManager::QueueUISignal(const FMounteaDialogueUISignal& Signal)
+{
+	if (!UMounteaDialogueManagerStatics::IsServer(GetOwner()))
+		return;
+
+	if (!PendingUISignals.Add(Signal) || UISignalFlushHandle.IsValid())
+		return;
+
+	UISignalFlushHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UMounteaDialogueManager::FlushUISignals);
+}
+
+void UMounteaDialogueManager::QueueClearUISignals(const FGuid& SessionGUID)
+{
+	FMounteaDialogueUISignal sentinel;
+	sentinel.SessionGUID = SessionGUID;
+	sentinel.RequiredContextVersion = INT32_MAX;
+	QueueUISignal(sentinel);
+}
+
+void UMounteaDialogueManager::FlushUISignals(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+		return;
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(UISignalFlushHandle);
+	UISignalFlushHandle.Reset();
+
+	if (PendingUISignals.IsEmpty())
+		return;
+
+	// Signals queued while the RPC executes in-process on a listen server start a new batch
+	FMounteaDialogueUISignalBatch batch = MoveTemp(PendingUISignals);
+	PendingUISignals.Reset();
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	UMounteaDialogueWorldSubsystem* subsystem = World ? World->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	if (FMounteaDialogueSessionStats* sessionStats = subsystem ? subsystem->FindSessionStats(batch.Signals[0].SessionGUID) : nullptr)
+	{
+		FBitWriter batchWriter(0, true);
+		bool bBatchSerialized = true;
+		batch.NetSerialize(batchWriter, nullptr, bBatchSerialized);
+		MOUNTEA_DIALOGUE_SESSION_STATS_RPC(*sessionStats, TEXT("Client_DispatchUISignalBatch"), batchWriter.GetNumBytes());
+	}
+#endif
+
+	Client_DispatchUISignalBatch(batch);
+}
+
+void UMounteaDialogueManager::Client_DispatchUISignalBatch_Implementation(const FMounteaDialogueUISignalBatch& Batch)
+{
+	for (const FMounteaDialogueUISignal& signal : Batch.Signals)
+		OnDialogueUISignalRequested.Broadcast(signal);
+}
+
 void UMounteaDialogueManager::PrepareNode_Implementation()
 {
 	const FGuid sessionGuid = IsValid(DialogueContext) ? DialogueContext->SessionGUID : FGuid();
@@ -671,10 +785,10 @@ void UMounteaDialogueManager::PrepareNode_Implementation()
 		if (!subsystem)
 			return;
 
-		UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 		if (!session)
 		{
-			OnDialogueFailed.Broadcast(TEXT("[Prepare Node] Missing Dialogue Session on GameState."));
+			OnDialogueFailed.Broadcast(TEXT("[Prepare Node] No Dialogue Session is running for this Manager."));
 			return;
 		}
 
@@ -692,10 +806,10 @@ void UMounteaDialogueManager::NodePrepared_Implementation()
 		if (!subsystem)
 			return;
 
-		UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 		if (!session)
 		{
-			OnDialogueFailed.Broadcast(TEXT("[Node Prepared] Missing Dialogue Session on GameState."));
+			OnDialogueFailed.Broadcast(TEXT("[Node Prepared] No Dialogue Session is running for this Manager."));
 			return;
 		}
 
@@ -713,10 +827,10 @@ void UMounteaDialogueManager::ProcessNode_Implementation()
 		if (!subsystem)
 			return;
 
-		UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 		if (!session)
 		{
-			OnDialogueFailed.Broadcast(TEXT("[Process Node] Missing Dialogue Session on GameState."));
+			OnDialogueFailed.Broadcast(TEXT("[Process Node] No Dialogue Session is running for this Manager."));
 			return;
 		}
 
@@ -739,10 +853,10 @@ void UMounteaDialogueManager::NodeProcessed_Implementation()
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Node Processed] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Node Processed] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
@@ -763,10 +877,10 @@ void UMounteaDialogueManager::SelectNode_Implementation(const FGuid& NodeGuid)
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Select Node] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Select Node] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
@@ -782,10 +896,10 @@ void UMounteaDialogueManager::ProcessDialogueRow_Implementation()
 		if (!subsystem)
 			return;
 
-		UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 		if (!session)
 		{
-			OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] Missing Dialogue Session on GameState."));
+			OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] No Dialogue Session is running for this Manager."));
 			return;
 		}
 
@@ -812,10 +926,10 @@ void UMounteaDialogueManager::DialogueRowProcessed_Implementation(const bool bFo
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Process Dialogue Row] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
@@ -836,10 +950,10 @@ void UMounteaDialogueManager::SkipDialogueRow_Implementation()
 	if (!subsystem)
 		return;
 
-	UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	UMounteaDialogueSession* session = subsystem->FindSessionForManager(this);
 	if (!session)
 	{
-		OnDialogueFailed.Broadcast(TEXT("[Skip Dialogue Row] Missing Dialogue Session on GameState."));
+		OnDialogueFailed.Broadcast(TEXT("[Skip Dialogue Row] No Dialogue Session is running for this Manager."));
 		return;
 	}
 
@@ -992,7 +1106,7 @@ void UMounteaDialogueManager::ExecuteWidgetCommand_Implementation(const FString&
 
 	UWorld* world = GetWorld();
 	UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-	const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
+	const UMounteaDialogueSession* session = subsystem ? subsystem->FindSessionForManager(this) : nullptr;
 	if (!session || !IsValid(DialogueContext) || !DialogueContext->SessionGUID.IsValid())
 	{
 		LOG_WARNING(TEXT("[MounteaDialogueManager] ExecuteWidgetCommand('%s') skipped: no valid active session/context."), *Command);
@@ -1012,10 +1126,10 @@ void UMounteaDialogueManager::ExecuteWidgetCommand_Implementation(const FString&
 
 	if (UMounteaDialogueManagerStatics::IsServer(GetOwner()))
 	{
-		Client_DispatchUISignal(signal);
+		QueueUISignal(signal);
 
 		if (bIsCloseCommand)
-			Client_ClearUISignals(signal.SessionGUID);
+			QueueClearUISignals(signal.SessionGUID);
 	}
 	else if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(world))
 	{
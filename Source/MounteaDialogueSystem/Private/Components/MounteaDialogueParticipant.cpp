@@ -9,12 +9,13 @@
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueManagerStatics.h"
 #include "Helpers/MounteaDialogueParticipantStatics.h"
-#include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
 #include "Sound/SoundBase.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 #if WITH_EDITOR
 #include "Engine/BlueprintGeneratedClass.h"
@@ -74,6 +75,9 @@ void UMounteaDialogueParticipant::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (bTraversedPathPending)
+		RefreshTraversedPath();
+
 	OnDialogueGraphChanged.AddUniqueDynamic(this, &UMounteaDialogueParticipant::OnDialogueGraphChangedEvent);
 
 	Execute_SetParticipantState(this, Execute_GetDefaultParticipantState(this));
@@ -92,6 +96,22 @@ void UMounteaDialogueParticipant::BeginPlay()
 		participantOwner->SetReplicates(GetIsReplicated());
 }
 
+void UMounteaDialogueParticipant::OnUnregister()
+{
+	if (TraversedGraphRegisteredHandle.IsValid())
+	{
+		if (UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this))
+			graphRegistry->OnGraphLoadFinished().Remove(TraversedGraphRegisteredHandle);
+		TraversedGraphRegisteredHandle.Reset();
+	}
+
+	const UWorld* world = GetWorld();
+	if (UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->InvalidateParticipantCache(GetOwner());
+
+	Super::OnUnregister();
+}
+
 void UMounteaDialogueParticipant::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -106,19 +126,8 @@ void UMounteaDialogueParticipant::InitializeParticipant_Implementation(const TSc
 
 	if (DialogueManager != Manager)
 		DialogueManager = Manager;
-	
-	for (const auto& Itr : DialogueGraph->GetAllNodes())
-	{
-		if (Itr)
-			Itr->InitializeNode(GetWorld());
-	}
-	
-	TArray<FMounteaDialogueDecorator> Decorators = UMounteaDialogueTraversalStatics::GetAllDialogueDecorators(DialogueGraph);
-	for (const auto& Itr : Decorators)
-	{
-		if (Itr.DecoratorType)
-			Itr.DecoratorType->InitializeDecorator(GetWorld(), this, Manager);
-	}
+
+	// Graph is shared between Sessions, its Decorators are bound by the Session and Nodes initialize once they become active
 }
 
 UAudioComponent* UMounteaDialogueParticipant::FindAudioComponent() const
@@ -324,7 +333,7 @@ void UMounteaDialogueParticipant::SaveStartingNode_Implementation(UMounteaDialog
 {
 	if (!DialogueGraph) 
 		return;
-	if (!DialogueGraph->GetAllNodes().Contains(NewStartingNode)) 
+	if (!DialogueGraph->GetAllNodesView().Contains(NewStartingNode)) 
 		return;
 
 	StartingNode = NewStartingNode;
@@ -465,30 +474,103 @@ void UMounteaDialogueParticipant::SetAudioComponent_Implementation(UAudioCompone
 	}
 }
 
-//TODO: instead of the Actor handling this logic realtime, make FRunnable queue and let data be calculated async way
 void UMounteaDialogueParticipant::SaveTraversedPath_Implementation(TArray<FDialogueTraversePath>& InPath)
 {
-	TMap<TPair<FGuid, FGuid>, int32> pathMap;
-	pathMap.Reserve(TraversedPath.Num() + InPath.Num());
-	
-	for (const auto& Path : TraversedPath)
+	if (bTraversedPathPending)
+		RefreshTraversedPath();
+
+	if (InPath.IsEmpty())
+		return;
+
+	// Merge is proportional to the finished dialogue, not to the whole history
+	TraversedPath.Reserve(TraversedPath.Num() + InPath.Num());
+	for (const auto& Path : InPath)
 	{
-		pathMap.Add(Path.GetGuidPair(), Path.TraverseCount);
+		const UMounteaDialogueGraph* graph = FindTraversedGraph(Path.GraphGuid);
+		TraversedPathIndex.Add(TraversedPath, Path.NodeGuid, Path.GraphGuid, Path.TraverseCount);
+		CompactTraversedPath.AddResolved(Path, graph ? graph->FindStableNodeIndex(Path.NodeGuid) : INDEX_NONE);
 	}
+}
 
-	for (const auto& Path : InPath)
+void UMounteaDialogueParticipant::Serialize(FArchive& Ar)
+{
+	if (!Ar.IsSaveGame())
 	{
-		int32& traversedCount = pathMap.FindOrAdd(Path.GetGuidPair());
-		traversedCount += Path.TraverseCount;
+		Super::Serialize(Ar);
+		return;
 	}
-	
-	TraversedPath.Empty(pathMap.Num());
-	for (const auto& Pair : pathMap)
+
+	// Save games carry only the compact form, the array is rebuilt from it once loaded
+	if (Ar.IsSaving())
+	{
+		TArray<FDialogueTraversePath> traversedPath = MoveTemp(TraversedPath);
+		TraversedPath.Reset();
+		Super::Serialize(Ar);
+		TraversedPath = MoveTemp(traversedPath);
+		return;
+	}
+
+	// Values equal to defaults are not written, stale paths must not survive loading
+	TraversedPath.Reset();
+	CompactTraversedPath.Reset();
+
+	Super::Serialize(Ar);
+
+	// Save games written before the compact form only contain the array
+	if (!TraversedPath.IsEmpty())
+		CompactTraversedPath.Append(TraversedPath, [this](const FGuid& GraphGuid) { return FindTraversedGraph(GraphGuid); });
+
+	RefreshTraversedPath();
+}
+
+void UMounteaDialogueParticipant::RefreshTraversedPath()
+{
+	TraversedPath.Reset();
+	TraversedPathIndex.Reset();
+	bTraversedPathPending = !CompactTraversedPath.ToTraversedPath(TraversedPath,
+		[this](const FGuid& GraphGuid) { return FindTraversedGraph(GraphGuid); });
+
+	// Missing history is added as soon as the Graph Registry registers its Graph, not only on BeginPlay or the next save
+	UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+	if (!graphRegistry)
+		return;
+
+	if (bTraversedPathPending && !TraversedGraphRegisteredHandle.IsValid())
+		TraversedGraphRegisteredHandle = graphRegistry->OnGraphLoadFinished().AddUObject(this, &UMounteaDialogueParticipant::OnTraversedGraphRegistered);
+	else if (!bTraversedPathPending && TraversedGraphRegisteredHandle.IsValid())
 	{
-		TraversedPath.Add(FDialogueTraversePath(Pair.Key.Key, Pair.Key.Value, Pair.Value));
+		graphRegistry->OnGraphLoadFinished().Remove(TraversedGraphRegisteredHandle);
+		TraversedGraphRegisteredHandle.Reset();
 	}
 }
 
+void UMounteaDialogueParticipant::OnTraversedGraphRegistered(const FGuid& GraphGuid, UMounteaDialogueGraph* Graph)
+{
+	if (Graph && bTraversedPathPending && CompactTraversedPath.ContainsGraph(GraphGuid))
+		RefreshTraversedPath();
+}
+
+TArray<FDialogueTraversePath> UMounteaDialogueParticipant::GetTraversedPath_Implementation() const
+{
+	return TraversedPath;
+}
+
+int32 UMounteaDialogueParticipant::GetNodeTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	// Read from the compact form, Traversed Path misses Graphs which were not resident when it was rebuilt
+	return CompactTraversedPath.GetTraverseCount(NodeGuid, GraphGuid,
+		[this](const FGuid& TraversedGraphGuid) { return FindTraversedGraph(TraversedGraphGuid); });
+}
+
+const UMounteaDialogueGraph* UMounteaDialogueParticipant::FindTraversedGraph(const FGuid& GraphGuid) const
+{
+	if (DialogueGraph && DialogueGraph->GetGraphGUID() == GraphGuid)
+		return DialogueGraph;
+
+	const UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+	return graphRegistry ? graphRegistry->FindGraph(GraphGuid) : nullptr;
+}
+
 void UMounteaDialogueParticipant::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
 	SetComponentTickEnabled(true);
@@ -529,6 +611,11 @@ void UMounteaDialogueParticipant::UpdateParticipantTick()
 	}
 }
 
+void UMounteaDialogueParticipant::OnRep_CompactTraversedPath()
+{
+	RefreshTraversedPath();
+}
+
 void UMounteaDialogueParticipant::OnRep_ParticipantState()
 {
 	OnDialogueParticipantStateChanged.Broadcast(ParticipantState);
@@ -586,7 +673,7 @@ void UMounteaDialogueParticipant::GetLifetimeReplicatedProps(TArray<FLifetimePro
 
 	DOREPLIFETIME_CONDITION(UMounteaDialogueParticipant, DialogueGraph,				COND_AutonomousOnly);
 	DOREPLIFETIME_CONDITION(UMounteaDialogueParticipant, DefaultParticipantState,	COND_AutonomousOnly);
-	DOREPLIFETIME_CONDITION(UMounteaDialogueParticipant, TraversedPath,				COND_AutonomousOnly);
+	DOREPLIFETIME_CONDITION(UMounteaDialogueParticipant, CompactTraversedPath,		COND_AutonomousOnly);
 	DOREPLIFETIME_CONDITION(UMounteaDialogueParticipant, StartingNode,				COND_AutonomousOnly);
 	
 	DOREPLIFETIME(UMounteaDialogueParticipant, ParticipantState);
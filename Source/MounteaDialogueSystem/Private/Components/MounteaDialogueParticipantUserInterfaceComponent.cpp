@@ -12,6 +12,7 @@
 #include "Components/MounteaDialogueParticipantUserInterfaceComponent.h"
 
 #include "Blueprint/UserWidget.h"
+#include "Components/MounteaDialogueManager.h"
 #include "Components/MounteaDialogueSession.h"
 #include "TimerManager.h"
 #include "Data/MounteaDialogueContext.h"
@@ -88,6 +89,10 @@ void UMounteaDialogueParticipantUserInterfaceComponent::BindToManager_Implementa
 	Execute_SetParentManager(this, Manager);
 	Manager->GetDialogueUISignalEventHandle().AddUniqueDynamic(this, &UMounteaDialogueParticipantUserInterfaceComponent::OnUISignalReceived);
 	BindLifecycleDelegates(Manager);
+
+	// Payload may have replicated before the UI was bound, deliver it now that signals have a target
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->DispatchPendingClientPayloads(Cast<UMounteaDialogueManager>(Manager.GetObject()));
 }
 
 void UMounteaDialogueParticipantUserInterfaceComponent::UnbindFromManager_Implementation()
@@ -291,10 +296,7 @@ void UMounteaDialogueParticipantUserInterfaceComponent::ExecuteUISignal(const FM
 	if (Signal.bForceReconcile)
 	{
 		// Pull current payload from session and perform full UI state reconcile.
-		const UWorld* world = GetWorld();
-		const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-		const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
-		if (session)
+		if (const UMounteaDialogueSession* session = FindParentManagerSession())
 			ReconcileFromPayload(session->GetContextPayload());
 		return;
 	}
@@ -348,15 +350,7 @@ void UMounteaDialogueParticipantUserInterfaceComponent::OnContextVersionUpdated(
 	if (!IsValid(Context))
 		return;
 
-	const UWorld* world = GetWorld();
-	if (!world)
-		return;
-
-	const UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>();
-	if (!subsystem)
-		return;
-
-	const UMounteaDialogueSession* session = subsystem->GetGameStateSession();
+	const UMounteaDialogueSession* session = FindParentManagerSession();
 	if (!session)
 		return;
 
@@ -541,8 +535,7 @@ void UMounteaDialogueParticipantUserInterfaceComponent::BeginSelectPrediction(co
 	PendingPredictionNodeGUID = NodeGuid;
 
 	const UWorld* world = GetWorld();
-	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-	const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
+	const UMounteaDialogueSession* session = FindParentManagerSession();
 	PendingPredictionStartContextVersion = session ? session->GetContextPayload().ContextVersion : 0;
 
 	const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
@@ -569,8 +562,7 @@ void UMounteaDialogueParticipantUserInterfaceComponent::BeginClosePrediction(con
 	PendingPredictionSessionGUID = SessionGuid;
 
 	const UWorld* world = GetWorld();
-	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-	const UMounteaDialogueSession* session = subsystem ? subsystem->GetGameStateSession() : nullptr;
+	const UMounteaDialogueSession* session = FindParentManagerSession();
 	PendingPredictionStartContextVersion = session ? session->GetContextPayload().ContextVersion : 0;
 
 	const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
@@ -621,16 +613,11 @@ void UMounteaDialogueParticipantUserInterfaceComponent::RollbackPrediction(const
 		PendingPredictionType == EDialogueClientPredictionType::Select ? TEXT("Select") : TEXT("Close"),
 		*Reason)
 
-	const UWorld* world = GetWorld();
-	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
-	if (subsystem)
+	if (const UMounteaDialogueSession* session = FindParentManagerSession())
 	{
-		if (const UMounteaDialogueSession* session = subsystem->GetGameStateSession())
-		{
-			const FMounteaDialogueContextPayload& payload = session->GetContextPayload();
-			if (payload.IsValid())
-				ReconcileFromPayload(payload);
-		}
+		const FMounteaDialogueContextPayload& payload = session->GetContextPayload();
+		if (payload.IsValid())
+			ReconcileFromPayload(payload);
 	}
 
 	if (PendingPredictionType == EDialogueClientPredictionType::Close)
@@ -733,3 +720,10 @@ void UMounteaDialogueParticipantUserInterfaceComponent::OnDialogueRowFinished(UM
 {
 	// Row completion state is reconciled from the next payload version.
 }
+
+const UMounteaDialogueSession* UMounteaDialogueParticipantUserInterfaceComponent::FindParentManagerSession() const
+{
+	const UWorld* world = GetWorld();
+	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	return subsystem ? subsystem->FindSessionForManager(Cast<UMounteaDialogueManager>(ParentManager.GetObject())) : nullptr;
+}
@@ -13,18 +13,26 @@
 #include "Components/MounteaDialogueManager.h"
 #include "Data/MounteaDialogueContext.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Graph/MounteaDialogueGraph.h"
 #include "Helpers/MounteaDialogueContextStatics.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueManagerStatics.h"
 #include "Helpers/MounteaDialogueParticipantStatics.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
 #include "Interfaces/Nodes/MounteaDialogueSpeechDataInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/Misc/NetConditionGroupManager.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
 #include "Subsystem/MounteaDialogueWorldSubsystem.h"
 #include "TimerManager.h"
 
@@ -37,6 +45,30 @@ UMounteaDialogueSession::UMounteaDialogueSession()
 void UMounteaDialogueSession::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+		RegisterAudienceNetGroup();
+
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->RegisterSession(this);
+}
+
+void UMounteaDialogueSession::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->UnregisterSession(this);
+
+	ClearReplicationAudience();
+	StopAwaitingGraph();
+	ReleaseChildGraphs();
+	InstanceData.Reset(GetWorld());
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		subsystem->ArchiveSessionStats(SessionStats);
+#endif
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMounteaDialogueSession::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -46,6 +78,7 @@ void UMounteaDialogueSession::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 	FDoRepLifetimeParams Params;
 	Params.bIsPushBased = true;
 	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaDialogueSession, ContextPayload, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaDialogueSession, SessionManager, Params);
 }
 
 void UMounteaDialogueSession::OnRep_ContextPayload()
@@ -57,9 +90,30 @@ void UMounteaDialogueSession::OnRep_ContextPayload()
 	{
 		LastDeliveredSessionGUID = ContextPayload.SessionGUID;
 		LastDeliveredContextVersion = 0;
+		ReleaseChildGraphs();
 	}
 
+	if (ContextPayload.bNodeAddressingMismatch)
+	{
+		ReportNodeAddressingMismatch();
+		return;
+	}
+
+	// Payload is delivered once the full row arrives
+	if (ContextPayload.bActiveRowUnresolved && ReportUnresolvedDialogueRow())
+		return;
+
 	const int32 newVersion = ContextPayload.ContextVersion;
+
+	// Participants or row assets mapped after the version was delivered, managers need to see them
+	const bool bReferencesRemapped = ContextPayload.bReferencesRemapped;
+	ContextPayload.bReferencesRemapped = false;
+	if (bReferencesRemapped && newVersion > 0 && newVersion == LastDeliveredContextVersion)
+	{
+		NotifyLocalManagers();
+		return;
+	}
+
 	if (newVersion <= 0 || newVersion <= LastDeliveredContextVersion)
 	{
 		const FString staleKey = FString::Printf(TEXT("Diag.Session.OnRep.Client.Version"));
@@ -77,6 +131,59 @@ void UMounteaDialogueSession::OnRep_ContextPayload()
 	NotifyLocalManagers();
 }
 
+void UMounteaDialogueSession::ReportNodeAddressingMismatch()
+{
+	// Only the owning client can ask for GUID addressing, others ignore this Session anyway
+	UMounteaDialogueManager* localManager = GetLocalSessionManager();
+	if (!localManager || ReportedAddressingMismatchGraphGUID == ContextPayload.ActiveGraphGUID)
+		return;
+
+	LOG_WARNING(TEXT("[Dialogue Session] Local Graph '%s' differs from the server one, requesting GUID addressing."), *ContextPayload.ActiveGraphGUID.ToString())
+	ReportedAddressingMismatchGraphGUID = ContextPayload.ActiveGraphGUID;
+	localManager->ReportNodeAddressingMismatch_Server(ContextPayload.SessionGUID, ContextPayload.ActiveGraphGUID);
+}
+
+bool UMounteaDialogueSession::ReportUnresolvedDialogueRow()
+{
+	UMounteaDialogueManager* localManager = GetLocalSessionManager();
+	if (!localManager)
+		return false;
+
+	if (ReportedUnresolvedRowTable.Get() != ContextPayload.ActiveRowTable)
+	{
+		LOG_WARNING(TEXT("[Dialogue Session] Dialogue Row '%s' is missing from local '%s', requesting full rows."),
+			*ContextPayload.ActiveRowName.ToString(), *GetNameSafe(ContextPayload.ActiveRowTable))
+		ReportedUnresolvedRowTable = ContextPayload.ActiveRowTable;
+		localManager->ReportUnresolvedDialogueRow_Server(ContextPayload.SessionGUID, ContextPayload.ActiveRowTable);
+	}
+	return true;
+}
+
+void UMounteaDialogueSession::OnRep_SessionManager()
+{
+	// Back in the pool, the dialogue no longer needs its child Graphs
+	if (!SessionManager)
+	{
+		ReleaseChildGraphs();
+		StopAwaitingGraph();
+	}
+
+	if (!bAwaitingSessionManager || !SessionManager)
+		return;
+
+	bAwaitingSessionManager = false;
+	NotifyLocalManagers();
+}
+
+UMounteaDialogueManager* UMounteaDialogueSession::GetLocalSessionManager() const
+{
+	UMounteaDialogueManager* manager = SessionManager;
+	if (!IsValid(manager) || !IsValid(manager->GetOwner()))
+		return nullptr;
+
+	return UMounteaDialogueManagerStatics::IsLocalPlayer(manager->GetOwner()) ? manager : nullptr;
+}
+
 void UMounteaDialogueSession::WriteContextPayload(FMounteaDialogueContextPayload NewPayload)
 {
 	if (!GetOwner() || !GetOwner()->HasAuthority())
@@ -88,24 +195,111 @@ void UMounteaDialogueSession::WriteContextPayload(FMounteaDialogueContextPayload
 		return;
 	}
 
-	const bool bSessionChanged = ContextPayload.SessionGUID.IsValid()
-		&& NewPayload.SessionGUID.IsValid()
-		&& ContextPayload.SessionGUID != NewPayload.SessionGUID;
-	if (bSessionChanged)
-	{
-		RoleOverrides.Empty();
-		SessionTraversedPath.Empty();
-	}
+	if (ContextPayload.SessionGUID.IsValid() && ContextPayload.SessionGUID != NewPayload.SessionGUID)
+		ResetSessionState();
 
+	ResolveCompactReferences(NewPayload);
 	NewPayload.ContextVersion = ContextPayload.ContextVersion + 1;
+	NewPayload.StampChangedFields(ContextPayload);
+	// Row assignment regenerates RowGUID, the stamped one must survive so clients holding the row still match
+	const FGuid activeRowGuid = NewPayload.ActiveDialogueRow.RowGUID;
 	ContextPayload = MoveTemp(NewPayload);
+	ContextPayload.ActiveDialogueRow.RowGUID = activeRowGuid;
+	PublishContextPayload();
+}
+
+bool UMounteaDialogueSession::BeginContextPayloadEdit(const UMounteaDialogueContext* DialogueContext)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !IsValid(DialogueContext))
+		return false;
+
+	const FGuid sessionGuid = DialogueContext->SessionGUID.IsValid() ? DialogueContext->SessionGUID : ContextPayload.SessionGUID;
+	if (!sessionGuid.IsValid())
+	{
+		LOG_WARNING(TEXT("[MounteaDialogueSession] Context payload edit skipped — invalid SessionGUID."))
+		return false;
+	}
+
+	if (ContextPayload.SessionGUID.IsValid() && ContextPayload.SessionGUID != sessionGuid)
+		ResetSessionState();
+
+	// Setters stamp changed fields with the upcoming version
+	ContextPayload.ContextVersion++;
+	ContextPayload.SetSessionGUID(sessionGuid);
+	ContextPayload.SetParticipants(DialogueContext->ActiveDialogueParticipant, DialogueContext->DialogueParticipants);
+	ContextPayload.SetActiveRow(DialogueContext->ActiveDialogueRow, DialogueContext->ActiveDialogueRowDataIndex);
+	return true;
+}
+
+void UMounteaDialogueSession::CommitContextPayloadEdit()
+{
+	ResolveCompactReferences(ContextPayload);
+	PublishContextPayload();
+}
+
+void UMounteaDialogueSession::ResetSessionState()
+{
+	RoleOverrides.Empty();
+	SessionTraversedPath.Empty();
+	SessionTraversedPathIndex.Reset();
+	TraversedPathRevision++;
+	ConditionCache.Reset();
+}
+
+void UMounteaDialogueSession::PublishContextPayload()
+{
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	SessionStats.PayloadWrites++;
+#endif
 	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaDialogueSession, ContextPayload, this);
 	LastDeliveredContextVersion = ContextPayload.ContextVersion;
 	LastDeliveredSessionGUID = ContextPayload.SessionGUID;
 
+	// Participants and speaker may change with any write, audience must include them before the payload replicates
+	UpdateReplicationAudience();
 	NotifyLocalManagers();
 }
 
+void UMounteaDialogueSession::ResolveCompactReferences(FMounteaDialogueContextPayload& Payload) const
+{
+	UDataTable* rowTable = nullptr;
+	FName rowName = NAME_None;
+
+	const UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+	UMounteaDialogueGraph* activeGraph = graphRegistry ? graphRegistry->FindGraph(Payload.ActiveGraphGUID) : nullptr;
+	if (IsValid(activeGraph))
+	{
+		const int32 nodeIndex = activeGraph->FindNodeIndexByGuid(Payload.ActiveNodeGUID);
+		activeGraph->GetCompiledGraph().GetSpeechRowHandle(nodeIndex, rowTable, rowName);
+	}
+
+	Payload.UpdateNodeAddressing(activeGraph);
+	Payload.UpdateActiveRowHandle(rowTable, rowName);
+}
+
+void UMounteaDialogueSession::ResendNodeReferences()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !ContextPayload.IsValid())
+		return;
+
+	// Connection flags are already updated, bumping the version lets delta replication send the references again
+	ContextPayload.ContextVersion++;
+	ContextPayload.StampNodeReferenceFields();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaDialogueSession, ContextPayload, this);
+	LastDeliveredContextVersion = ContextPayload.ContextVersion;
+}
+
+void UMounteaDialogueSession::ResendActiveDialogueRow()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !ContextPayload.IsValid())
+		return;
+
+	ContextPayload.ContextVersion++;
+	ContextPayload.StampActiveRowField();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaDialogueSession, ContextPayload, this);
+	LastDeliveredContextVersion = ContextPayload.ContextVersion;
+}
+
 void UMounteaDialogueSession::TryDispatchPendingClientPayload()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
@@ -116,37 +310,24 @@ void UMounteaDialogueSession::TryDispatchPendingClientPayload()
 		return;
 
 	if (!bClientDispatchPending)
-	{
-		if (world->GetTimerManager().IsTimerActive(PendingDispatchRetryTimer))
-			world->GetTimerManager().ClearTimer(PendingDispatchRetryTimer);
 		return;
-	}
 
 	UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>();
 	if (!subsystem)
 		return;
 
-	for (UMounteaDialogueManager* manager : subsystem->GetRegisteredManagers())
+	UMounteaDialogueManager* localManager = GetLocalSessionManager();
+	if (localManager && subsystem->GetRegisteredManagers().Contains(localManager))
 	{
-		if (!IsValid(manager))
-			continue;
-
-		const AActor* ownerActor = manager->GetOwner();
-		if (!IsValid(ownerActor))
-			continue;
+		if (AwaitActiveGraph())
+			return;
 
-		const bool bIsLocal = UMounteaDialogueManagerStatics::IsLocalPlayer(ownerActor);
-		if (!bIsLocal)
-			continue;
-		
-		manager->OnContextPayloadUpdated(ContextPayload);
+		localManager->OnContextPayloadUpdated(ContextPayload);
 		bClientDispatchPending = false;
 		LastPendingDispatchWarningVersion = 0;
 		PendingClientDispatchVersion = 0;
 		PendingClientDispatchSessionGUID.Invalidate();
-		if (world->GetTimerManager().IsTimerActive(PendingDispatchRetryTimer))
-			world->GetTimerManager().ClearTimer(PendingDispatchRetryTimer);
-		LOG_INFO(TEXT("[Dialogue Session] Delivered pending payload version %d to local manager '%s'."), ContextPayload.ContextVersion, *GetNameSafe(manager))
+		LOG_INFO(TEXT("[Dialogue Session] Delivered pending payload version %d to local manager '%s'."), ContextPayload.ContextVersion, *GetNameSafe(localManager))
 		return;
 	}
 
@@ -157,14 +338,148 @@ void UMounteaDialogueSession::TryDispatchPendingClientPayload()
 			*PendingClientDispatchSessionGUID.ToString(), PendingClientDispatchVersion)
 		LOG_WARNING(TEXT("[Dialogue Session] Pending payload version %d could not be delivered yet: no local manager registered."), PendingClientDispatchVersion)
 	}
-
-	if (!world->GetTimerManager().IsTimerActive(PendingDispatchRetryTimer))
-		world->GetTimerManager().SetTimer(PendingDispatchRetryTimer, this, &UMounteaDialogueSession::TryDispatchPendingClientPayload, 0.25f, true);
 }
 
 void UMounteaDialogueSession::SetAuthoritativeManager(UMounteaDialogueManager* Manager)
 {
 	AuthoritativeManager = Manager;
+
+	if (SessionManager != Manager)
+	{
+		// New dialogue or returning to the pool, state of the previous dialogue must not leak
+		InstanceData.Reset(GetWorld());
+
+		SessionManager = Manager;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaDialogueSession, SessionManager, this);
+		UpdateReplicationAudience();
+	}
+}
+
+void UMounteaDialogueSession::RegisterAudienceNetGroup()
+{
+	AActor* owner = GetOwner();
+	if (!owner->IsUsingRegisteredSubObjectList())
+	{
+		LOG_WARNING(TEXT("[Dialogue Session] '%s' does not replicate using registered subobject list, Session '%s' replicates to every connection."), *GetNameSafe(owner), *GetName())
+		return;
+	}
+
+	AudienceNetGroup = FName(*FString::Printf(TEXT("MounteaDialogueSession.%s"), *GetName()));
+	UE::Net::FNetConditionGroupManager::RegisterSubObjectInGroup(this, AudienceNetGroup);
+	owner->SetReplicatedComponentNetCondition(this, COND_NetGroup);
+}
+
+void UMounteaDialogueSession::UpdateReplicationAudience()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || AudienceNetGroup.IsNone())
+		return;
+
+	UWorld* world = GetWorld();
+	if (!world)
+		return;
+
+	// Pooled Session keeps its audience until the next dialogue, the audience still has to see it return to the pool
+	if (!IsValid(SessionManager))
+	{
+		world->GetTimerManager().ClearTimer(AudienceRefreshTimer);
+		return;
+	}
+
+	TArray<APlayerController*, TInlineAllocator<4>> audience;
+	auto addActorConnection = [&audience](AActor* Actor)
+	{
+		int searchDepth = 0;
+		if (APlayerController* playerController = IsValid(Actor) ? UMounteaDialogueSystemBFC::FindPlayerController(Actor, searchDepth) : nullptr)
+			audience.AddUnique(playerController);
+	};
+
+	addActorConnection(SessionManager->GetOwner());
+	for (const TScriptInterface<IMounteaDialogueParticipantInterface>& participant : ContextPayload.DialogueParticipants)
+	{
+		if (participant.GetObject())
+			addActorConnection(IMounteaDialogueParticipantInterface::Execute_GetOwningActor(participant.GetObject()));
+	}
+
+	const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
+	const float eavesdropRadius = settings ? settings->GetEavesdropRadius() : 0.f;
+	UObject* speakerObject = ContextPayload.ActiveDialogueParticipant.GetObject();
+	const AActor* speaker = speakerObject ? IMounteaDialogueParticipantInterface::Execute_GetOwningActor(speakerObject) : nullptr;
+	if (eavesdropRadius > 0.f && IsValid(speaker))
+	{
+		const FVector speakerLocation = speaker->GetActorLocation();
+		const float radiusSquared = FMath::Square(eavesdropRadius);
+		for (FConstPlayerControllerIterator it = world->GetPlayerControllerIterator(); it; ++it)
+		{
+			APlayerController* playerController = it->Get();
+			const APawn* pawn = playerController ? playerController->GetPawn() : nullptr;
+			if (pawn && FVector::DistSquared(pawn->GetActorLocation(), speakerLocation) <= radiusSquared)
+				audience.AddUnique(playerController);
+		}
+	}
+
+	for (const TWeakObjectPtr<APlayerController>& member : AudienceControllers)
+	{
+		APlayerController* playerController = member.Get();
+		if (playerController && !audience.Contains(playerController))
+			playerController->RemoveFromNetConditionGroup(AudienceNetGroup);
+	}
+
+	AudienceControllers.Reset(audience.Num());
+	for (APlayerController* playerController : audience)
+	{
+		if (!playerController->IsMemberOfNetConditionGroup(AudienceNetGroup))
+			playerController->IncludeInNetConditionGroup(AudienceNetGroup);
+		AudienceControllers.Add(playerController);
+	}
+
+	// Participants do not move in and out of the audience, only eavesdroppers need refreshing
+	if (eavesdropRadius <= 0.f)
+		world->GetTimerManager().ClearTimer(AudienceRefreshTimer);
+	else if (!world->GetTimerManager().IsTimerActive(AudienceRefreshTimer))
+		world->GetTimerManager().SetTimer(AudienceRefreshTimer, this, &UMounteaDialogueSession::UpdateReplicationAudience, settings->GetEavesdropRefreshInterval(), true);
+}
+
+void UMounteaDialogueSession::ClearReplicationAudience()
+{
+	if (UWorld* world = GetWorld())
+		world->GetTimerManager().ClearTimer(AudienceRefreshTimer);
+
+	if (AudienceNetGroup.IsNone())
+		return;
+
+	for (const TWeakObjectPtr<APlayerController>& member : AudienceControllers)
+	{
+		if (APlayerController* playerController = member.Get())
+			playerController->RemoveFromNetConditionGroup(AudienceNetGroup);
+	}
+	AudienceControllers.Empty();
+
+	UE::Net::FNetConditionGroupManager::UnregisterSubObjectFromGroup(this, AudienceNetGroup);
+	AudienceNetGroup = NAME_None;
+}
+
+void UMounteaDialogueSession::PreloadChildGraphs(UMounteaDialogueGraph* Graph)
+{
+	if (!IsValid(Graph) || PreloadedGraphGUIDs.Contains(Graph->GetGraphGUID()))
+		return;
+
+	if (UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this))
+	{
+		graphRegistry->PreloadChildGraphs(Graph);
+		PreloadedGraphGUIDs.Add(Graph->GetGraphGUID());
+	}
+}
+
+void UMounteaDialogueSession::ReleaseChildGraphs()
+{
+	UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+	if (graphRegistry)
+	{
+		for (const FGuid& graphGuid : PreloadedGraphGUIDs)
+			graphRegistry->ReleaseChildGraphs(graphGuid);
+	}
+
+	PreloadedGraphGUIDs.Reset();
 }
 
 void UMounteaDialogueSession::FinalizeSession()
@@ -181,12 +496,62 @@ void UMounteaDialogueSession::FinalizeSession()
 
 			TArray<FDialogueTraversePath> participantPath = SessionTraversedPath;
 			UMounteaDialogueParticipantStatics::SaveTraversedPath(participant, participantPath);
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+			SessionStats.TraversedPathEntries += participantPath.Num();
+#endif
 		}
 	}
 
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	SessionStats.EndSeconds = FPlatformTime::Seconds();
+#endif
+
 	AuthoritativeManager.Reset();
 	RoleOverrides.Empty();
 	SessionTraversedPath.Empty();
+	SessionTraversedPathIndex.Reset();
+	TraversedPathRevision++;
+	ConditionCache.Reset();
+	InstanceData.Reset(GetWorld());
+	ReleaseChildGraphs();
+}
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+void UMounteaDialogueSession::BeginSessionStats(const FGuid& SessionGUID, const UMounteaDialogueGraph* Graph)
+{
+	if (SessionStats.IsValid())
+	{
+		if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+			subsystem->ArchiveSessionStats(SessionStats);
+	}
+
+	SessionStats.Begin(SessionGUID, Graph ? Graph->GetName() : FString());
+}
+#endif
+
+int32 UMounteaDialogueSession::GetNodeActivationCount(const UMounteaDialogueGraphNode* Node) const
+{
+	const FMounteaDialogueNodeInstanceData* nodeData = InstanceData.FindNodeData(Node);
+	return nodeData ? nodeData->ActivationCount : 0;
+}
+
+float UMounteaDialogueSession::GetDecoratorValue(const UMounteaDialogueDecoratorBase* Decorator, const FName Key, const float DefaultValue) const
+{
+	if (!IsValid(Decorator))
+		return DefaultValue;
+
+	return InstanceData.GetDecoratorValue(Decorator->GetDecoratorGUID(), Key, DefaultValue);
+}
+
+void UMounteaDialogueSession::SetDecoratorValue(const UMounteaDialogueDecoratorBase* Decorator, const FName Key, const float Value)
+{
+	if (!IsValid(Decorator))
+	{
+		LOG_WARNING(TEXT("[Set Decorator Value] Invalid Decorator, value '%s' is not stored."), *Key.ToString())
+		return;
+	}
+
+	InstanceData.SetDecoratorValue(Decorator->GetDecoratorGUID(), Key, Value);
 }
 
 void UMounteaDialogueSession::SetRoleOverride(const EDialogueParticipantType Role, const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant)
@@ -228,24 +593,31 @@ void UMounteaDialogueSession::AddTraversedNode(const UMounteaDialogueGraphNode*
 	if (!IsValid(TraversedNode))
 		return;
 
-	FDialogueTraversePath* existingEntry = SessionTraversedPath.FindByPredicate(
-		[TraversedNode](const FDialogueTraversePath& Path)
-		{
-			return Path.NodeGuid == TraversedNode->GetNodeGUID()
-				&& Path.GraphGuid == TraversedNode->GetGraphGUID();
-		});
+	TraversedPathRevision++;
+	SessionTraversedPathIndex.Add(SessionTraversedPath, TraversedNode->GetNodeGUID(), TraversedNode->GetGraphGUID());
+}
 
-	if (existingEntry)
+int32 UMounteaDialogueSession::GetConditionTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	if (SessionTraversedPath.Num() > 0)
+		return SessionTraversedPathIndex.GetTraverseCount(SessionTraversedPath, NodeGuid, GraphGuid);
+
+	for (const auto& participant : ContextPayload.DialogueParticipants)
 	{
-		existingEntry->TraverseCount++;
-		return;
+		if (!participant.GetObject() || !participant.GetInterface())
+			continue;
+		const int32 traverseCount = participant->GetNodeTraverseCount(NodeGuid, GraphGuid);
+		if (traverseCount > 0)
+			return traverseCount;
 	}
+	return 0;
+}
 
-	FDialogueTraversePath newEntry;
-	newEntry.NodeGuid = TraversedNode->GetNodeGUID();
-	newEntry.GraphGuid = TraversedNode->GetGraphGUID();
-	newEntry.TraverseCount = 1;
-	SessionTraversedPath.Add(newEntry);
+FMounteaDialogueConditionCache* UMounteaDialogueSession::GetConditionCache(FMounteaDialogueConditionRevision& OutRevision) const
+{
+	OutRevision.ContextVersion = ContextPayload.ContextVersion;
+	OutRevision.TraversedPathRevision = TraversedPathRevision;
+	return &ConditionCache;
 }
 
 TArray<FDialogueTraversePath> UMounteaDialogueSession::GetConditionTraversedPath_Implementation() const
@@ -285,15 +657,11 @@ void UMounteaDialogueSession::NotifyLocalManagers()
 			return;
 		}
 
-		for (UMounteaDialogueManager* manager : subsystem->GetRegisteredManagers())
+		// Other managers run their own Sessions, only the Session Manager can take over
+		if (IsValid(SessionManager))
 		{
-			if (!IsValid(manager))
-				continue;
-			if (!IsValid(manager->GetOwner()) || !manager->GetOwner()->HasAuthority())
-				continue;
-
-			AuthoritativeManager = manager;
-			manager->OnContextPayloadUpdated(ContextPayload);
+			AuthoritativeManager = SessionManager;
+			SessionManager->OnContextPayloadUpdated(ContextPayload);
 			return;
 		}
 
@@ -303,26 +671,27 @@ void UMounteaDialogueSession::NotifyLocalManagers()
 		return;
 	}
 
-	for (UMounteaDialogueManager* manager : subsystem->GetRegisteredManagers())
+	// Sessions of other clients are replicated too, their managers are not resolved or not local here
+	if (!SessionManager)
 	{
-		if (!IsValid(manager))
-			continue;
+		bAwaitingSessionManager = true;
+		return;
+	}
 
-		const AActor* ownerActor = manager->GetOwner();
-		if (!IsValid(ownerActor))
-			continue;
+	UMounteaDialogueManager* localManager = GetLocalSessionManager();
+	if (!localManager)
+		return;
 
-		const bool bIsLocal = UMounteaDialogueManagerStatics::IsLocalPlayer(ownerActor);
-		if (!bIsLocal)
-			continue;
+	if (subsystem->GetRegisteredManagers().Contains(localManager))
+	{
+		if (AwaitActiveGraph())
+			return;
 
-		manager->OnContextPayloadUpdated(ContextPayload);
+		localManager->OnContextPayloadUpdated(ContextPayload);
 		bClientDispatchPending = false;
 		LastPendingDispatchWarningVersion = 0;
 		PendingClientDispatchVersion = 0;
 		PendingClientDispatchSessionGUID.Invalidate();
-		if (world->GetTimerManager().IsTimerActive(PendingDispatchRetryTimer))
-			world->GetTimerManager().ClearTimer(PendingDispatchRetryTimer);
 		return;
 	}
 
@@ -331,8 +700,75 @@ void UMounteaDialogueSession::NotifyLocalManagers()
 	PendingClientDispatchVersion = ContextPayload.ContextVersion;
 	LOG_ERROR_KEY(FString::Printf(TEXT("Diag.Session.Notify.ClientPending")), TEXT("[Diag][Session][Notify] Client dispatch pending. Session=%s Version=%d"),
 		*PendingClientDispatchSessionGUID.ToString(), PendingClientDispatchVersion)
-	if (!world->GetTimerManager().IsTimerActive(PendingDispatchRetryTimer))
-		world->GetTimerManager().SetTimer(PendingDispatchRetryTimer, this, &UMounteaDialogueSession::TryDispatchPendingClientPayload, 0.25f, true);
+	// Delivered once the manager registers, see UMounteaDialogueWorldSubsystem::DispatchPendingClientPayloads
+}
+
+bool UMounteaDialogueSession::AwaitActiveGraph()
+{
+	const FGuid activeGraphGuid = ContextPayload.ActiveGraphGUID;
+	UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+	if (!activeGraphGuid.IsValid() || !graphRegistry)
+		return false;
+
+	// Resolving registers participant Graphs and requests the load of a known, not resident one
+	if (UMounteaDialogueGraph* activeGraph = UMounteaDialogueManagerStatics::ResolveGraphByGuid(ContextPayload.DialogueParticipants, activeGraphGuid))
+	{
+		// Clients never run the server preload, Graphs this one opens have to be resident before the payload names them
+		PreloadChildGraphs(activeGraph);
+		StopAwaitingGraph();
+
+		// Node indices received before the Graph was resident are checked against it only now
+		if (!ContextPayload.ResolveDeferredNodeAddressing(activeGraph))
+		{
+			ReportNodeAddressingMismatch();
+			return true;
+		}
+		return false;
+	}
+
+	// Unknown or failed Graphs never arrive, Manager falls back to the participant Graph
+	if (graphRegistry->GetGraphLoadState(activeGraphGuid) != EMounteaDialogueGraphLoadState::Loading)
+	{
+		StopAwaitingGraph();
+
+		// Without the Graph received Node indices cannot be resolved, the server has to send GUIDs
+		if (!ContextPayload.ResolveDeferredNodeAddressing(nullptr))
+		{
+			ReportNodeAddressingMismatch();
+			return true;
+		}
+		return false;
+	}
+
+	AwaitedGraphGUID = activeGraphGuid;
+	if (!GraphLoadFinishedHandle.IsValid())
+		GraphLoadFinishedHandle = graphRegistry->OnGraphLoadFinished().AddUObject(this, &UMounteaDialogueSession::HandleGraphLoadFinished);
+
+	bClientDispatchPending = true;
+	PendingClientDispatchSessionGUID = ContextPayload.SessionGUID;
+	PendingClientDispatchVersion = ContextPayload.ContextVersion;
+	LOG_INFO(TEXT("[Dialogue Session] Payload version %d waits for Graph '%s' to stream in."), ContextPayload.ContextVersion, *activeGraphGuid.ToString())
+	return true;
+}
+
+void UMounteaDialogueSession::HandleGraphLoadFinished(const FGuid& GraphGUID, UMounteaDialogueGraph* Graph)
+{
+	if (GraphGUID != AwaitedGraphGUID)
+		return;
+
+	StopAwaitingGraph();
+	TryDispatchPendingClientPayload();
+}
+
+void UMounteaDialogueSession::StopAwaitingGraph()
+{
+	AwaitedGraphGUID.Invalidate();
+	if (!GraphLoadFinishedHandle.IsValid())
+		return;
+
+	if (UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this))
+		graphRegistry->OnGraphLoadFinished().Remove(GraphLoadFinishedHandle);
+	GraphLoadFinishedHandle.Reset();
 }
 
 bool UMounteaDialogueSession::IsSessionRequestValid(UMounteaDialogueManager* Manager, const FGuid& SessionGUID, const TCHAR* ActionName) const
@@ -386,96 +822,53 @@ bool UMounteaDialogueSession::IsSessionRequestValid(UMounteaDialogueManager* Man
 
 void UMounteaDialogueSession::ApplyNodeSwitchPayload(const UMounteaDialogueContext* DialogueContext)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority() || !IsValid(DialogueContext))
+	if (!BeginContextPayloadEdit(DialogueContext))
 		return;
 
-	FMounteaDialogueContextPayload newPayload = ContextPayload;
-
-	if (DialogueContext->SessionGUID.IsValid())
-		newPayload.SessionGUID = DialogueContext->SessionGUID;
-
-	newPayload.DialogueParticipants = DialogueContext->DialogueParticipants;
-	newPayload.ActiveDialogueParticipant = DialogueContext->ActiveDialogueParticipant;
-	newPayload.ActiveDialogueRow = DialogueContext->ActiveDialogueRow;
-	newPayload.ActiveDialogueRowDataIndex = DialogueContext->ActiveDialogueRowDataIndex;
-
 	if (IsValid(DialogueContext->ActiveNode))
 	{
-		newPayload.PreviousNodeGUID = ContextPayload.ActiveNodeGUID;
-		newPayload.ActiveNodeGUID = DialogueContext->ActiveNode->GetNodeGUID();
-		newPayload.ActiveGraphGUID = DialogueContext->ActiveNode->GetGraphGUID();
-	}
-	else
-	{
-		newPayload.ActiveNodeGUID.Invalidate();
-		newPayload.ActiveGraphGUID.Invalidate();
-	}
+		ContextPayload.SetPreviousNode(ContextPayload.ActiveNodeGUID);
+		ContextPayload.SetActiveNode(DialogueContext->ActiveNode->GetNodeGUID(), DialogueContext->ActiveNode->GetGraphGUID());
 
-	newPayload.AllowedChildNodeGUIDs.Reset();
-	for (UMounteaDialogueGraphNode* childNode : DialogueContext->AllowedChildNodes)
-	{
-		if (IsValid(childNode))
-			newPayload.AllowedChildNodeGUIDs.Add(childNode->GetNodeGUID());
+		// Start streaming child Graphs before traversal reaches the Open Child Graph Node
+		const UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(this);
+		if (graphRegistry && graphRegistry->IsNodeNearChildGraph(DialogueContext->ActiveNode))
+			PreloadChildGraphs(DialogueContext->ActiveNode->GetGraph());
 	}
+	else
+		ContextPayload.SetActiveNode(FGuid(), FGuid());
 
-	WriteContextPayload(MoveTemp(newPayload));
+	ContextPayload.SetAllowedChildNodes(DialogueContext->AllowedChildNodes);
+	CommitContextPayloadEdit();
 }
 
 void UMounteaDialogueSession::ApplyAllowedChildrenPayload(const UMounteaDialogueContext* DialogueContext)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority() || !IsValid(DialogueContext))
+	if (!BeginContextPayloadEdit(DialogueContext))
 		return;
 
-	FMounteaDialogueContextPayload newPayload = ContextPayload;
-
-	if (DialogueContext->SessionGUID.IsValid())
-		newPayload.SessionGUID = DialogueContext->SessionGUID;
-
-	newPayload.DialogueParticipants = DialogueContext->DialogueParticipants;
-	newPayload.ActiveDialogueParticipant = DialogueContext->ActiveDialogueParticipant;
-	newPayload.ActiveDialogueRow = DialogueContext->ActiveDialogueRow;
-	newPayload.ActiveDialogueRowDataIndex = DialogueContext->ActiveDialogueRowDataIndex;
-
 	if (IsValid(DialogueContext->ActiveNode))
-	{
-		newPayload.ActiveNodeGUID = DialogueContext->ActiveNode->GetNodeGUID();
-		newPayload.ActiveGraphGUID = DialogueContext->ActiveNode->GetGraphGUID();
-	}
-
-	newPayload.PreviousNodeGUID = DialogueContext->PreviousActiveNode.IsValid()
-		? DialogueContext->PreviousActiveNode
-		: newPayload.PreviousNodeGUID;
+		ContextPayload.SetActiveNode(DialogueContext->ActiveNode->GetNodeGUID(), DialogueContext->ActiveNode->GetGraphGUID());
 
-	newPayload.AllowedChildNodeGUIDs.Reset();
-	for (UMounteaDialogueGraphNode* childNode : DialogueContext->AllowedChildNodes)
-	{
-		if (IsValid(childNode))
-			newPayload.AllowedChildNodeGUIDs.Add(childNode->GetNodeGUID());
-	}
+	if (DialogueContext->PreviousActiveNode.IsValid())
+		ContextPayload.SetPreviousNode(DialogueContext->PreviousActiveNode);
 
-	WriteContextPayload(MoveTemp(newPayload));
+	ContextPayload.SetAllowedChildNodes(DialogueContext->AllowedChildNodes);
+	CommitContextPayloadEdit();
 }
 
 void UMounteaDialogueSession::ApplyRowStatePayload(const UMounteaDialogueContext* DialogueContext)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority() || !IsValid(DialogueContext))
+	if (!BeginContextPayloadEdit(DialogueContext))
 		return;
 
-	FMounteaDialogueContextPayload newPayload = ContextPayload;
-
-	if (DialogueContext->SessionGUID.IsValid())
-		newPayload.SessionGUID = DialogueContext->SessionGUID;
-
-	newPayload.DialogueParticipants = DialogueContext->DialogueParticipants;
-	newPayload.ActiveDialogueParticipant = DialogueContext->ActiveDialogueParticipant;
-	newPayload.ActiveDialogueRow = DialogueContext->ActiveDialogueRow;
-	newPayload.ActiveDialogueRowDataIndex = DialogueContext->ActiveDialogueRowDataIndex;
-
-	WriteContextPayload(MoveTemp(newPayload));
+	CommitContextPayloadEdit();
 }
 
 bool UMounteaDialogueSession::HandleSelectNode(UMounteaDialogueManager* Manager, const FGuid& SessionGUID, const FGuid& NodeGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleSelectNode"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Select Node")))
 		return false;	
 
@@ -486,7 +879,7 @@ bool UMounteaDialogueSession::HandleSelectNode(UMounteaDialogueManager* Manager,
 		return false;
 	}
 	
-	Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+	Manager->QueueUISignal(FMounteaDialogueUISignal{
 		MounteaDialogueWidgetCommands::RemoveDialogueOptions,
 		dialogueContext->SessionGUID,
 		ContextPayload.ContextVersion,
@@ -494,7 +887,7 @@ bool UMounteaDialogueSession::HandleSelectNode(UMounteaDialogueManager* Manager,
 	});
 
 	UMounteaDialogueGraphNode* selectedNode = nullptr;
-	for (UMounteaDialogueGraphNode* childNode : dialogueContext->GetChildrenNodes())
+	for (UMounteaDialogueGraphNode* childNode : dialogueContext->GetChildrenNodesView())
 	{
 		if (IsValid(childNode) && childNode->GetNodeGUID() == NodeGUID)
 		{
@@ -511,11 +904,11 @@ bool UMounteaDialogueSession::HandleSelectNode(UMounteaDialogueManager* Manager,
 		return false;
 	}
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildNodes = UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(selectedNode, dialogueContext);
-	UMounteaDialogueTraversalStatics::SortNodes(allowedChildNodes);
+	FMounteaDialogueNodeBuffer allowedChildNodes;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(selectedNode, dialogueContext, allowedChildNodes, true);
 
 	dialogueContext->SetDialogueContext(selectedNode, allowedChildNodes);
-	dialogueContext->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(selectedNode));
+	dialogueContext->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(selectedNode));
 	dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 	const TScriptInterface<IMounteaDialogueParticipantInterface> newActiveParticipant = UMounteaDialogueTraversalStatics::ResolveActiveParticipant(dialogueContext);
 	UMounteaDialogueTraversalStatics::UpdateMatchingDialogueParticipant(dialogueContext, newActiveParticipant);
@@ -529,6 +922,8 @@ bool UMounteaDialogueSession::HandleSelectNode(UMounteaDialogueManager* Manager,
 
 bool UMounteaDialogueSession::HandleSkipDialogueRow(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleSkipDialogueRow"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Skip Dialogue Row")))
 		return false;
 
@@ -546,7 +941,8 @@ bool UMounteaDialogueSession::HandleSkipDialogueRow(UMounteaDialogueManager* Man
 		return false;
 	}
 
-	world->GetTimerManager().ClearTimer(Manager->GetDialogueRowTimerHandle());
+	if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
+		subsystem->ClearDialogueTimer(Manager->GetDialogueRowTimer());
 
 	if (dialogueContext->ActiveDialogueParticipant.GetObject() && dialogueContext->ActiveDialogueParticipant.GetInterface())
 	{
@@ -561,6 +957,8 @@ bool UMounteaDialogueSession::HandleSkipDialogueRow(UMounteaDialogueManager* Man
 
 bool UMounteaDialogueSession::HandleNodeProcessed(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleNodeProcessed"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Node Processed")))
 		return false;
 
@@ -580,8 +978,8 @@ bool UMounteaDialogueSession::HandleNodeProcessed(UMounteaDialogueManager* Manag
 	Manager->GetDialogueNodeFinishedEventHandle().Broadcast(dialogueContext);
 	dialogueContext->ActiveNode->CleanupNode();
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes = UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(dialogueContext->ActiveNode, dialogueContext);
-	UMounteaDialogueTraversalStatics::SortNodes(allowedChildrenNodes);
+	FMounteaDialogueNodeBuffer allowedChildrenNodes;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(dialogueContext->ActiveNode, dialogueContext, allowedChildrenNodes, true);
 
 	if (allowedChildrenNodes.Num() == 0)
 	{
@@ -598,18 +996,18 @@ bool UMounteaDialogueSession::HandleNodeProcessed(UMounteaDialogueManager* Manag
 	UMounteaDialogueGraphNode* newActiveNode = foundNodePtr ? *foundNodePtr : nullptr;
 	if (newActiveNode != nullptr)
 	{
-		TArray<UMounteaDialogueGraphNode*> allowedChildNodes = UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(newActiveNode, dialogueContext);
-		UMounteaDialogueTraversalStatics::SortNodes(allowedChildNodes);
+		FMounteaDialogueNodeBuffer allowedChildNodes;
+		UMounteaDialogueTraversalStatics::GetAllowedChildNodes(newActiveNode, dialogueContext, allowedChildNodes, true);
 
 		dialogueContext->SetDialogueContext(newActiveNode, allowedChildNodes);
-		dialogueContext->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(newActiveNode));
+		dialogueContext->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(newActiveNode));
 		dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 		const TScriptInterface<IMounteaDialogueParticipantInterface> newActiveParticipant = UMounteaDialogueTraversalStatics::ResolveActiveParticipant(dialogueContext);
 		UMounteaDialogueTraversalStatics::UpdateMatchingDialogueParticipant(dialogueContext, newActiveParticipant);
 
 		Manager->GetDialogueNodeSelectedEventHandle().Broadcast(dialogueContext);
 		ApplyNodeSwitchPayload(dialogueContext);
-		Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+		Manager->QueueUISignal(FMounteaDialogueUISignal{
 			MounteaDialogueWidgetCommands::RemoveDialogueOptions,
 			dialogueContext->SessionGUID,
 			ContextPayload.ContextVersion,
@@ -619,12 +1017,12 @@ bool UMounteaDialogueSession::HandleNodeProcessed(UMounteaDialogueManager* Manag
 		return true;
 	}
 
-	dialogueContext->AllowedChildNodes = allowedChildrenNodes;
+	dialogueContext->UpdateAllowedChildrenNodes(allowedChildrenNodes);
 	dialogueContext->UpdateActiveDialogueRow(FDialogueRow::Invalid());
 	dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 	ApplyAllowedChildrenPayload(dialogueContext);
 
-	Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+	Manager->QueueUISignal(FMounteaDialogueUISignal{
 		MounteaDialogueWidgetCommands::AddDialogueOptions,
 		dialogueContext->SessionGUID,
 		ContextPayload.ContextVersion,
@@ -636,6 +1034,8 @@ bool UMounteaDialogueSession::HandleNodeProcessed(UMounteaDialogueManager* Manag
 
 bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager* Manager, const FGuid& SessionGUID, const bool bForceFinish)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleDialogueRowProcessed"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Process Dialogue Row")))
 		return false;
 
@@ -656,12 +1056,14 @@ bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager
 		return false;
 	}
 
-	world->GetTimerManager().ClearTimer(Manager->GetDialogueRowTimerHandle());
+	if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
+		subsystem->ClearDialogueTimer(Manager->GetDialogueRowTimer());
 
 	const int32 currentIndex = dialogueContext->GetActiveDialogueRowDataIndex();
 	const int32 nextIndex = currentIndex + 1;
-	const FDialogueRow dialogueRow = dialogueContext->GetActiveDialogueRow();
-	const TArray<FDialogueRowData> rowDataArray = dialogueRow.RowData;
+	// Only execution modes are read before any event runs, the row is not copied
+	const FDialogueRow& dialogueRow = dialogueContext->GetActiveDialogueRow();
+	const TArray<FDialogueRowData>& rowDataArray = dialogueRow.RowData;
 
 	const bool bIsActiveRowValid = UMounteaDialogueTraversalStatics::IsDialogueRowValid(dialogueRow);
 	const bool bDialogueRowDataValid = rowDataArray.IsValidIndex(nextIndex)
@@ -683,7 +1085,7 @@ bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager
 			dialogueContext->UpdateActiveDialogueRowDataIndex(nextIndex);
 			Manager->GetDialogueContextUpdatedEventHande().Broadcast(dialogueContext);
 			ApplyRowStatePayload(dialogueContext);
-			Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+			Manager->QueueUISignal(FMounteaDialogueUISignal{
 				MounteaDialogueWidgetCommands::ShowDialogueRow,
 				dialogueContext->SessionGUID,
 				ContextPayload.ContextVersion,
@@ -692,7 +1094,7 @@ bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager
 			IMounteaDialogueManagerInterface::Execute_ProcessDialogueRow(Manager);
 			break;
 		case ERowExecutionMode::EREM_Stopping:
-			Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+			Manager->QueueUISignal(FMounteaDialogueUISignal{
 				MounteaDialogueWidgetCommands::HideDialogueRow,
 				dialogueContext->SessionGUID,
 				ContextPayload.ContextVersion,
@@ -707,7 +1109,7 @@ bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager
 		return true;
 	}
 
-	Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+	Manager->QueueUISignal(FMounteaDialogueUISignal{
 		MounteaDialogueWidgetCommands::HideDialogueRow,
 		dialogueContext->SessionGUID,
 		ContextPayload.ContextVersion,
@@ -719,6 +1121,8 @@ bool UMounteaDialogueSession::HandleDialogueRowProcessed(UMounteaDialogueManager
 
 bool UMounteaDialogueSession::HandleProcessDialogueRow(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleProcessDialogueRow"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Process Dialogue Row")))
 		return false;
 
@@ -740,14 +1144,14 @@ bool UMounteaDialogueSession::HandleProcessDialogueRow(UMounteaDialogueManager*
 		return true;
 
 	const int32 activeIndex = dialogueContext->GetActiveDialogueRowDataIndex();
-	const FDialogueRow row = dialogueContext->GetActiveDialogueRow();
+	const FDialogueRow& row = dialogueContext->ActiveDialogueRow;
 	if (!row.RowData.IsValidIndex(activeIndex))
 	{
 		IMounteaDialogueManagerInterface::Execute_DialogueRowProcessed(Manager, false);
 		return true;
 	}
 
-	const FDialogueRowData rowData = row.RowData[activeIndex];
+	const FDialogueRowData& rowData = row.RowData[activeIndex];
 	if (!UMounteaDialogueTraversalStatics::IsDialogueRowDataValid(rowData))
 	{
 		IMounteaDialogueManagerInterface::Execute_DialogueRowProcessed(Manager, false);
@@ -755,7 +1159,7 @@ bool UMounteaDialogueSession::HandleProcessDialogueRow(UMounteaDialogueManager*
 	}
 
 	Manager->GetDialogueRowStartedEventHandle().Broadcast(dialogueContext);
-	Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+	Manager->QueueUISignal(FMounteaDialogueUISignal{
 		MounteaDialogueWidgetCommands::ShowDialogueRow,
 		dialogueContext->SessionGUID,
 		ContextPayload.ContextVersion,
@@ -768,19 +1172,21 @@ bool UMounteaDialogueSession::HandleProcessDialogueRow(UMounteaDialogueManager*
 			rowData.RowSound);
 	}
 
-	FTimerDelegate delegate;
-	delegate.BindUObject(Manager, &UMounteaDialogueManager::DialogueRowProcessed_Implementation, false);
-	world->GetTimerManager().SetTimer(
-		Manager->GetDialogueRowTimerHandle(),
-		delegate,
-		UMounteaDialogueTraversalStatics::GetRowDuration(rowData),
-		false);
+	if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
+	{
+		FTimerDelegate delegate;
+		delegate.BindUObject(Manager, &UMounteaDialogueManager::DialogueRowProcessed_Implementation, false);
+		subsystem->ClearDialogueTimer(Manager->GetDialogueRowTimer());
+		Manager->GetDialogueRowTimer() = subsystem->SetDialogueTimer(delegate, UMounteaDialogueTraversalStatics::GetActiveRowDuration(dialogueContext));
+	}
 
 	return true;
 }
 
 bool UMounteaDialogueSession::HandlePrepareNode(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandlePrepareNode"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Prepare Node")))
 		return false;
 
@@ -799,12 +1205,32 @@ bool UMounteaDialogueSession::HandlePrepareNode(UMounteaDialogueManager* Manager
 
 	const TScriptInterface<IMounteaDialogueParticipantInterface> newActiveParticipant = UMounteaDialogueTraversalStatics::ResolveActiveParticipant(dialogueContext);
 	UMounteaDialogueTraversalStatics::UpdateMatchingDialogueParticipant(dialogueContext, newActiveParticipant);
+
+	// Graph Decorators are bound once per Session and Graph, Child Graphs are bound the first time one of their Nodes becomes active
+	const UMounteaDialogueGraph* activeGraph = dialogueContext->ActiveNode->GetGraph();
+	if (InstanceData.MarkGraphDecoratorsBound(activeGraph))
+	{
+		for (const auto& graphDecorator : activeGraph->GraphDecorators)
+		{
+			if (graphDecorator.DecoratorType)
+				graphDecorator.DecoratorType->InitializeDecorator(GetWorld(), newActiveParticipant, Manager);
+		}
+
+		for (const auto& graphDecorator : activeGraph->GraphScopeDecorators)
+		{
+			if (graphDecorator.DecoratorType)
+				graphDecorator.DecoratorType->InitializeDecorator(GetWorld(), newActiveParticipant, Manager);
+		}
+	}
+
 	dialogueContext->ActiveNode->PreProcessNode(Manager);
 	return true;
 }
 
 bool UMounteaDialogueSession::HandleNodePrepared(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleNodePrepared"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Node Prepared")))
 		return false;
 
@@ -816,13 +1242,17 @@ bool UMounteaDialogueSession::HandleNodePrepared(UMounteaDialogueManager* Manage
 	}
 
 	AddTraversedNode(dialogueContext->ActiveNode);
+	if (FMounteaDialogueNodeInstanceData* nodeData = InstanceData.FindOrAddNodeData(dialogueContext->ActiveNode))
+		++nodeData->ActivationCount;
 	dialogueContext->AddTraversedNode(dialogueContext->ActiveNode);
- 	IMounteaDialogueManagerInterface::Execute_ProcessNode(Manager);
+	IMounteaDialogueManagerInterface::Execute_ProcessNode(Manager);
 	return true;
 }
 
 bool UMounteaDialogueSession::HandleProcessNode(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleProcessNode"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Process Node")))
 		return false;
 
@@ -847,7 +1277,7 @@ bool UMounteaDialogueSession::HandleProcessNode(UMounteaDialogueManager* Manager
 	if (dialogueContext->ActiveNode != processingNode)
 	{
 		ApplyNodeSwitchPayload(dialogueContext);
-		Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+		Manager->QueueUISignal(FMounteaDialogueUISignal{
 			MounteaDialogueWidgetCommands::HideDialogueRow,
 			dialogueContext->SessionGUID,
 			ContextPayload.ContextVersion,
@@ -862,7 +1292,7 @@ bool UMounteaDialogueSession::HandleProcessNode(UMounteaDialogueManager* Manager
 
 	if (!processingNode->Implements<UMounteaDialogueSpeechDataInterface>())
 	{
-		Manager->Client_DispatchUISignal(FMounteaDialogueUISignal{
+		Manager->QueueUISignal(FMounteaDialogueUISignal{
 			MounteaDialogueWidgetCommands::HideDialogueRow,
 			dialogueContext->SessionGUID,
 			ContextPayload.ContextVersion,
@@ -881,6 +1311,8 @@ bool UMounteaDialogueSession::HandleProcessNode(UMounteaDialogueManager* Manager
 
 bool UMounteaDialogueSession::HandleCloseDialogue(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(SessionStats, TEXT("HandleCloseDialogue"));
+
 	if (!IsSessionRequestValid(Manager, SessionGUID, TEXT("Close Dialogue")))
 		return false;
 
@@ -44,3 +44,11 @@ void UMounteaDialogueConditionBase::SetConditionGUID(const FGuid& NewGUID)
 	if (ConditionGUID != NewGUID)
 		ConditionGUID = NewGUID;
 }
+
+bool UMounteaDialogueConditionBase::HasNativeEvaluation() const
+{
+	// Blueprint override lives in the generated class, native classes share the native function
+	static const FName evaluateConditionName = GET_FUNCTION_NAME_CHECKED(UMounteaDialogueConditionBase, EvaluateCondition);
+	const UFunction* evaluateFunction = FindFunction(evaluateConditionName);
+	return evaluateFunction && evaluateFunction->GetOwnerClass()->HasAnyClassFlags(CLASS_Native);
+}
@@ -21,27 +21,18 @@
 
 namespace MounteaDialogueConditionOnlyFirstTime
 {
-	bool HasTraversedNode(
-		const TArray<FDialogueTraversePath>& TraversedPath,
+	bool GetTargetGuids(
 		const UMounteaDialogueGraphNode* TargetNode,
-		const UMounteaDialogueGraph* TargetGraph)
+		const UMounteaDialogueGraph* TargetGraph,
+		FGuid& OutNodeGuid,
+		FGuid& OutGraphGuid)
 	{
 		if (!IsValid(TargetNode))
 			return false;
 
-		const FGuid targetNodeGuid = TargetNode->GetNodeGUID();
-		const FGuid targetGraphGuid = IsValid(TargetGraph) ? TargetGraph->GetGraphGUID() : TargetNode->GetGraphGUID();
-
-		if (!targetNodeGuid.IsValid() || !targetGraphGuid.IsValid())
-			return false;
-
-		const FDialogueTraversePath* foundEntry = TraversedPath.FindByPredicate(
-			[&](const FDialogueTraversePath& Entry)
-			{
-				return Entry.NodeGuid == targetNodeGuid && Entry.GraphGuid == targetGraphGuid;
-			});
-
-		return foundEntry != nullptr;
+		OutNodeGuid = TargetNode->GetNodeGUID();
+		OutGraphGuid = IsValid(TargetGraph) ? TargetGraph->GetGraphGUID() : TargetNode->GetGraphGUID();
+		return OutNodeGuid.IsValid() && OutGraphGuid.IsValid();
 	}
 
 	TArray<TScriptInterface<IMounteaDialogueParticipantInterface>> GetParticipantsFromContextObject(const UObject* ContextObject)
@@ -59,6 +50,8 @@ namespace MounteaDialogueConditionOnlyFirstTime
 UMounteaDialogueCondition_OnlyFirstTime::UMounteaDialogueCondition_OnlyFirstTime()
 {
 	ConditionName = TEXT("OnlyFirstTime");
+	// Reads only traversed paths of the context and its participants, participants are locked while the dialogue runs
+	Caching = EMounteaDialogueConditionCaching::Context;
 }
 
 bool UMounteaDialogueCondition_OnlyFirstTime::EvaluateCondition_Implementation(const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context) const
@@ -70,9 +63,13 @@ bool UMounteaDialogueCondition_OnlyFirstTime::EvaluateCondition_Implementation(c
 	if (!IsValid(owningEdge) || !IsValid(owningEdge->EndNode))
 		return true;
 
-	const TArray<FDialogueTraversePath> conditionPath =
-		IMounteaDialogueConditionContextInterface::Execute_GetConditionTraversedPath(Context.GetObject());
-	if (MounteaDialogueConditionOnlyFirstTime::HasTraversedNode(conditionPath, owningEdge->EndNode, owningEdge->Graph))
+	FGuid targetNodeGuid;
+	FGuid targetGraphGuid;
+	if (!MounteaDialogueConditionOnlyFirstTime::GetTargetGuids(owningEdge->EndNode, owningEdge->Graph, targetNodeGuid, targetGraphGuid))
+		return true;
+
+	// Hashed lookup, the traversed path is not copied
+	if (Context->GetConditionTraverseCount(targetNodeGuid, targetGraphGuid) > 0)
 		return false;
 
 	TScriptInterface<IMounteaDialogueParticipantInterface> participantToCheck;
@@ -87,8 +84,7 @@ bool UMounteaDialogueCondition_OnlyFirstTime::EvaluateCondition_Implementation(c
 
 	if (participantToCheck.GetObject() && participantToCheck.GetInterface())
 	{
-		const TArray<FDialogueTraversePath> participantPath = UMounteaDialogueParticipantStatics::GetTraversedPath(participantToCheck);
-		if (MounteaDialogueConditionOnlyFirstTime::HasTraversedNode(participantPath, owningEdge->EndNode, owningEdge->Graph))
+		if (participantToCheck->GetNodeTraverseCount(targetNodeGuid, targetGraphGuid) > 0)
 			return false;
 	}
 
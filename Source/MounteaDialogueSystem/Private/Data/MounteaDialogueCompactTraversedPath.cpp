@@ -0,0 +1,307 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Data/MounteaDialogueCompactTraversedPath.h"
+
+#include "Graph/MounteaDialogueGraph.h"
+
+namespace MounteaDialogueCompactTraversedPathEncoding
+{
+	// Bumped whenever the serialized layout changes.
+	constexpr uint8 FormatVersion = 1;
+
+	// Upper bounds accepted from the network, guard clients against malformed data.
+	constexpr uint32 MaxNetGraphs = 4096;
+	constexpr uint32 MaxNetNodes = 1 << 16;
+	constexpr uint32 MaxNetEntries = 1 << 16;
+
+	bool IsWithinNetLimit(const FArchive& Ar, const uint32 Value, const uint32 Limit)
+	{
+		return !Ar.IsLoading() || !Ar.IsNetArchive() || Value <= Limit;
+	}
+}
+
+int32 FMounteaDialogueGraphTraversal::GetTraverseCount(const int32 StableIndex) const
+{
+	if (!TraversedNodes.IsValidIndex(StableIndex) || !TraversedNodes[StableIndex])
+		return 0;
+
+	const int32* traverseCount = TraverseCounts.Find(StableIndex);
+	return traverseCount ? *traverseCount : 1;
+}
+
+void FMounteaDialogueGraphTraversal::Add(const int32 StableIndex, const int32 TraverseCount)
+{
+	if (StableIndex < 0)
+		return;
+
+	if (StableIndex >= TraversedNodes.Num())
+		TraversedNodes.Add(false, StableIndex + 1 - TraversedNodes.Num());
+
+	const int32 newCount = GetTraverseCount(StableIndex) + FMath::Max(0, TraverseCount);
+	TraversedNodes[StableIndex] = true;
+
+	if (newCount == 1)
+		TraverseCounts.Remove(StableIndex);
+	else
+		TraverseCounts.Add(StableIndex, newCount);
+}
+
+bool FMounteaDialogueGraphTraversal::operator==(const FMounteaDialogueGraphTraversal& Other) const
+{
+	return GraphGuid == Other.GraphGuid
+		&& TraversedNodes == Other.TraversedNodes
+		&& TraverseCounts.OrderIndependentCompareEqual(Other.TraverseCounts);
+}
+
+FArchive& operator<<(FArchive& Ar, FMounteaDialogueGraphTraversal& Traversal)
+{
+	using namespace MounteaDialogueCompactTraversedPathEncoding;
+
+	Ar << Traversal.GraphGuid;
+
+	uint32 nodeCount = Traversal.TraversedNodes.Num();
+	Ar.SerializeIntPacked(nodeCount);
+	if (!IsWithinNetLimit(Ar, nodeCount, MaxNetNodes))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	if (Ar.IsLoading())
+		Traversal.TraversedNodes.Init(false, nodeCount);
+
+	// Bits are written byte by byte, trailing bits of the last byte are always clear
+	const int32 byteCount = FMath::DivideAndRoundUp<int32>(nodeCount, 8);
+	if (byteCount > 0)
+		Ar.Serialize(Traversal.TraversedNodes.GetData(), byteCount);
+
+	uint32 countNum = Traversal.TraverseCounts.Num();
+	Ar.SerializeIntPacked(countNum);
+	if (!IsWithinNetLimit(Ar, countNum, nodeCount))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	if (Ar.IsLoading())
+	{
+		Traversal.TraverseCounts.Reset();
+		Traversal.TraverseCounts.Reserve(countNum);
+		for (uint32 i = 0; i < countNum && !Ar.IsError(); i++)
+		{
+			uint32 stableIndex = 0;
+			uint32 traverseCount = 0;
+			Ar.SerializeIntPacked(stableIndex);
+			Ar.SerializeIntPacked(traverseCount);
+			if (stableIndex < nodeCount)
+				Traversal.TraverseCounts.Add(stableIndex, traverseCount);
+		}
+	}
+	else
+	{
+		for (const auto& countPair : Traversal.TraverseCounts)
+		{
+			uint32 stableIndex = countPair.Key;
+			uint32 traverseCount = countPair.Value;
+			Ar.SerializeIntPacked(stableIndex);
+			Ar.SerializeIntPacked(traverseCount);
+		}
+	}
+
+	return Ar;
+}
+
+void FMounteaDialogueCompactTraversedPath::Add(const FDialogueTraversePath& Entry, FGraphResolver FindGraph)
+{
+	const UMounteaDialogueGraph* graph = FindGraph(Entry.GraphGuid);
+	AddResolved(Entry, graph ? graph->FindStableNodeIndex(Entry.NodeGuid) : INDEX_NONE);
+}
+
+void FMounteaDialogueCompactTraversedPath::AddResolved(const FDialogueTraversePath& Entry, const int32 StableIndex)
+{
+	if (StableIndex != INDEX_NONE)
+	{
+		FindOrAddGraph(Entry.GraphGuid).Add(StableIndex, Entry.TraverseCount);
+		return;
+	}
+
+	FDialogueTraversePath* existingEntry = UnresolvedEntries.FindByKey(Entry);
+	if (existingEntry)
+		existingEntry->IncrementCount(Entry.TraverseCount);
+	else
+		UnresolvedEntries.Add(Entry);
+}
+
+void FMounteaDialogueCompactTraversedPath::Append(TConstArrayView<FDialogueTraversePath> Path, FGraphResolver FindGraph)
+{
+	for (const FDialogueTraversePath& entry : Path)
+		Add(entry, FindGraph);
+}
+
+bool FMounteaDialogueCompactTraversedPath::ToTraversedPath(TArray<FDialogueTraversePath>& OutPath, FGraphResolver FindGraph) const
+{
+	bool bAllResolved = true;
+	for (const FMounteaDialogueGraphTraversal& graphTraversal : Graphs)
+	{
+		const UMounteaDialogueGraph* graph = FindGraph(graphTraversal.GraphGuid);
+		if (!graph)
+		{
+			bAllResolved = false;
+			continue;
+		}
+
+		for (TConstSetBitIterator<> bitIt(graphTraversal.TraversedNodes); bitIt; ++bitIt)
+		{
+			const FGuid nodeGuid = graph->GetStableNodeGuid(bitIt.GetIndex());
+			if (!nodeGuid.IsValid())
+			{
+				bAllResolved = false;
+				continue;
+			}
+
+			OutPath.Emplace(nodeGuid, graphTraversal.GraphGuid, graphTraversal.GetTraverseCount(bitIt.GetIndex()));
+		}
+	}
+
+	OutPath.Append(UnresolvedEntries);
+	return bAllResolved;
+}
+
+int32 FMounteaDialogueCompactTraversedPath::GetTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid, FGraphResolver FindGraph) const
+{
+	int32 traverseCount = 0;
+	const FMounteaDialogueGraphTraversal* graphTraversal = FindGraphTraversal(GraphGuid);
+	if (graphTraversal)
+	{
+		if (const UMounteaDialogueGraph* graph = FindGraph(GraphGuid))
+			traverseCount += graphTraversal->GetTraverseCount(graph->FindStableNodeIndex(NodeGuid));
+	}
+
+	// Entries added before their Graph could be resolved are kept verbatim
+	for (const FDialogueTraversePath& entry : UnresolvedEntries)
+	{
+		if (entry.NodeGuid == NodeGuid && entry.GraphGuid == GraphGuid)
+			traverseCount += entry.TraverseCount;
+	}
+
+	return traverseCount;
+}
+
+bool FMounteaDialogueCompactTraversedPath::ContainsGraph(const FGuid& GraphGuid) const
+{
+	return FindGraphTraversal(GraphGuid) != nullptr;
+}
+
+FMounteaDialogueCompactTraversedPath FMounteaDialogueCompactTraversedPath::FromTraversedPath(TConstArrayView<FDialogueTraversePath> Path, FGraphResolver FindGraph)
+{
+	FMounteaDialogueCompactTraversedPath result;
+	result.Append(Path, FindGraph);
+	return result;
+}
+
+void FMounteaDialogueCompactTraversedPath::Reset()
+{
+	Graphs.Reset();
+	UnresolvedEntries.Reset();
+}
+
+bool FMounteaDialogueCompactTraversedPath::Serialize(FArchive& Ar)
+{
+	using namespace MounteaDialogueCompactTraversedPathEncoding;
+
+	uint8 formatVersion = FormatVersion;
+	Ar << formatVersion;
+	if (Ar.IsLoading() && formatVersion > FormatVersion)
+	{
+		Ar.SetError();
+		return true;
+	}
+
+	uint32 graphCount = Graphs.Num();
+	Ar.SerializeIntPacked(graphCount);
+	if (!IsWithinNetLimit(Ar, graphCount, MaxNetGraphs))
+	{
+		Ar.SetError();
+		return true;
+	}
+
+	if (Ar.IsLoading())
+		Graphs.SetNum(graphCount);
+
+	for (FMounteaDialogueGraphTraversal& graphTraversal : Graphs)
+	{
+		Ar << graphTraversal;
+		if (Ar.IsError())
+			return true;
+	}
+
+	uint32 unresolvedCount = UnresolvedEntries.Num();
+	Ar.SerializeIntPacked(unresolvedCount);
+	if (!IsWithinNetLimit(Ar, unresolvedCount, MaxNetEntries))
+	{
+		Ar.SetError();
+		return true;
+	}
+
+	if (Ar.IsLoading())
+		UnresolvedEntries.SetNum(unresolvedCount);
+
+	for (FDialogueTraversePath& entry : UnresolvedEntries)
+	{
+		uint32 traverseCount = entry.TraverseCount;
+		Ar << entry.NodeGuid;
+		Ar << entry.GraphGuid;
+		Ar.SerializeIntPacked(traverseCount);
+		entry.TraverseCount = traverseCount;
+	}
+
+	return true;
+}
+
+bool FMounteaDialogueCompactTraversedPath::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Serialize(Ar);
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+bool FMounteaDialogueCompactTraversedPath::Identical(const FMounteaDialogueCompactTraversedPath* Other, uint32 PortFlags) const
+{
+	if (!Other || Graphs != Other->Graphs || UnresolvedEntries.Num() != Other->UnresolvedEntries.Num())
+		return false;
+
+	// Traverse Path equality ignores counts
+	for (int32 i = 0; i < UnresolvedEntries.Num(); i++)
+	{
+		if (UnresolvedEntries[i] != Other->UnresolvedEntries[i] || UnresolvedEntries[i].TraverseCount != Other->UnresolvedEntries[i].TraverseCount)
+			return false;
+	}
+
+	return true;
+}
+
+FMounteaDialogueGraphTraversal& FMounteaDialogueCompactTraversedPath::FindOrAddGraph(const FGuid& GraphGuid)
+{
+	if (FMounteaDialogueGraphTraversal* graphTraversal = Graphs.FindByPredicate(
+		[&GraphGuid](const FMounteaDialogueGraphTraversal& Traversal) { return Traversal.GraphGuid == GraphGuid; }))
+		return *graphTraversal;
+
+	FMounteaDialogueGraphTraversal& newTraversal = Graphs.AddDefaulted_GetRef();
+	newTraversal.GraphGuid = GraphGuid;
+	return newTraversal;
+}
+
+const FMounteaDialogueGraphTraversal* FMounteaDialogueCompactTraversedPath::FindGraphTraversal(const FGuid& GraphGuid) const
+{
+	return Graphs.FindByPredicate([&GraphGuid](const FMounteaDialogueGraphTraversal& Traversal) { return Traversal.GraphGuid == GraphGuid; });
+}
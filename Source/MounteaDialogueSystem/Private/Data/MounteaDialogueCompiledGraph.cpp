@@ -0,0 +1,347 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueCompiledGraph.h"
+
+#include "Edges/MounteaDialogueGraphEdge.h"
+#include "Engine/DataTable.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueConditionsStatics.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
+#include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Nodes/MounteaDialogueGraphNode_OpenChildGraph.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+#include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+#include "UObject/UObjectIterator.h"
+
+FDelegateHandle FMounteaDialogueCompiledGraph::ObjectsReplacedHandle;
+
+static EMounteaDialogueCompiledNodeType ResolveCompiledNodeType(const UMounteaDialogueGraphNode* Node)
+{
+	if (Node->IsA<UMounteaDialogueGraphNode_StartNode>())
+		return EMounteaDialogueCompiledNodeType::Start;
+	if (Node->IsA<UMounteaDialogueGraphNode_LeadNode>())
+		return EMounteaDialogueCompiledNodeType::Lead;
+	if (Node->IsA<UMounteaDialogueGraphNode_AnswerNode>())
+		return EMounteaDialogueCompiledNodeType::Answer;
+	if (Node->IsA<UMounteaDialogueGraphNode_CompleteNode>())
+		return EMounteaDialogueCompiledNodeType::Complete;
+	if (Node->IsA<UMounteaDialogueGraphNode_Delay>())
+		return EMounteaDialogueCompiledNodeType::Delay;
+	if (Node->IsA<UMounteaDialogueGraphNode_OpenChildGraph>())
+		return EMounteaDialogueCompiledNodeType::OpenChildGraph;
+	if (Node->IsA<UMounteaDialogueGraphNode_ReturnToNode>())
+		return EMounteaDialogueCompiledNodeType::ReturnToNode;
+
+	return EMounteaDialogueCompiledNodeType::Generic;
+}
+
+static uint32 ComputeSourceChecksum(const UMounteaDialogueGraph& Graph)
+{
+	uint32 checksum = 0;
+	for (const UMounteaDialogueGraphNode* node : Graph.AllNodes)
+	{
+		const FGuid nodeGuid = node ? node->GetNodeGUID() : FGuid();
+		checksum = FCrc::MemCrc32(&nodeGuid, sizeof(FGuid), checksum);
+		if (!node)
+			continue;
+
+		checksum = HashCombine(checksum, GetTypeHash(node->ExecutionOrder));
+		if (const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(node))
+		{
+			if (const UDataTable* dataTable = dialogueNode->GetDataTable())
+				checksum = FCrc::StrCrc32(*dataTable->GetPathName(), checksum);
+			checksum = FCrc::StrCrc32(*dialogueNode->GetRowName().ToString(), checksum);
+		}
+
+		const TConstArrayView<UMounteaDialogueGraphNode*> children = node->GetChildrenNodesView();
+		checksum = HashCombine(checksum, GetTypeHash(children.Num()));
+		for (int32 childSlot = 0; childSlot < children.Num(); ++childSlot)
+		{
+			const FGuid childGuid = children[childSlot] ? children[childSlot]->GetNodeGUID() : FGuid();
+			checksum = FCrc::MemCrc32(&childGuid, sizeof(FGuid), checksum);
+
+			const UMounteaDialogueGraphEdge* edge = node->GetChildEdge(childSlot);
+			if (!edge)
+				continue;
+
+			checksum = HashCombine(checksum, GetTypeHash(static_cast<uint8>(edge->EdgeConditions.Mode)));
+			for (const FMounteaDialogueCondition& rule : edge->EdgeConditions.Rules)
+				checksum = HashCombine(checksum, HashCombine(GetTypeHash(IsValid(rule.ConditionClass)), GetTypeHash(rule.bNegate)));
+		}
+	}
+
+	return checksum;
+}
+
+void FMounteaDialogueCompiledGraph::Compile(const UMounteaDialogueGraph& Graph)
+{
+	Reset();
+
+	const TArray<TObjectPtr<UMounteaDialogueGraphNode>>& allNodes = Graph.AllNodes;
+	const int32 nodeCount = allNodes.Num();
+
+	NodeGuids.Reserve(nodeCount);
+	NodeTypes.Reserve(nodeCount);
+	ExecutionOrders.Reserve(nodeCount);
+	SpeechTableIndices.Reserve(nodeCount);
+	SpeechRowNames.Reserve(nodeCount);
+	ChildOffsets.Reserve(nodeCount + 1);
+
+	for (int32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+	{
+		const UMounteaDialogueGraphNode* node = allNodes[nodeIndex];
+
+		ChildOffsets.Add(ChildIndices.Num());
+
+		if (!node)
+		{
+			NodeGuids.Add(FGuid());
+			NodeTypes.Add(EMounteaDialogueCompiledNodeType::Generic);
+			ExecutionOrders.Add(INDEX_NONE);
+			SpeechTableIndices.Add(INDEX_NONE);
+			SpeechRowNames.Add(NAME_None);
+			continue;
+		}
+
+		NodeGuids.Add(node->GetNodeGUID());
+		NodeTypes.Add(ResolveCompiledNodeType(node));
+		ExecutionOrders.Add(node->ExecutionOrder);
+
+		if (node == Graph.StartNode)
+			StartNodeIndex = nodeIndex;
+
+		int32 tableIndex = INDEX_NONE;
+		FName rowName = NAME_None;
+		if (const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(node))
+		{
+			if (UDataTable* dataTable = dialogueNode->GetDataTable())
+			{
+				tableIndex = SpeechTables.AddUnique(dataTable);
+				rowName = dialogueNode->GetRowName();
+			}
+		}
+		SpeechTableIndices.Add(tableIndex);
+		SpeechRowNames.Add(rowName);
+
+		// Slot order follows ChildrenNodes, unresolved children keep their slot so indices stay aligned
+		const TConstArrayView<UMounteaDialogueGraphNode*> children = node->GetChildrenNodesView();
+		for (int32 childSlot = 0; childSlot < children.Num(); ++childSlot)
+		{
+			const UMounteaDialogueGraphNode* child = children[childSlot];
+			const int32 childIndex = child ? Graph.FindNodeIndexByGuid(child->GetNodeGUID()) : INDEX_NONE;
+			if (childIndex == INDEX_NONE)
+				LOG_WARNING(TEXT("[Compile Graph] Graph %s: child %d of Node %s is not part of the Graph, the child slot will never be traversed."), *Graph.GetName(), childSlot, *node->GetNodeGUID().ToString())
+
+			ChildIndices.Add(childIndex);
+			ConditionOffsets.Add(ConditionRuleIndices.Num());
+
+			const UMounteaDialogueGraphEdge* edge = child ? node->GetChildEdge(childSlot) : nullptr;
+			if (!edge)
+			{
+				ConditionModes.Add(EConditionEvaluationMode::All);
+				continue;
+			}
+
+			ConditionModes.Add(edge->EdgeConditions.Mode);
+			const TArray<FMounteaDialogueCondition>& rules = edge->EdgeConditions.Rules;
+			for (int32 ruleIndex = 0; ruleIndex < rules.Num(); ++ruleIndex)
+			{
+				// Same as runtime evaluation, invalid rules are ignored
+				if (IsValid(rules[ruleIndex].ConditionClass))
+					ConditionRuleIndices.Add(ruleIndex);
+			}
+		}
+	}
+
+	ChildOffsets.Add(ChildIndices.Num());
+	ConditionOffsets.Add(ConditionRuleIndices.Num());
+	CompileConditionOps(Graph);
+
+	if (StartNodeIndex == INDEX_NONE && Graph.StartNode)
+		StartNodeIndex = Graph.FindNodeIndexByGuid(Graph.StartNode->GetNodeGUID());
+
+	CompileOpenChildGraphDistances();
+
+	const FGuid graphGuid = Graph.GetGraphGUID();
+	NodeTableChecksum = FCrc::MemCrc32(&graphGuid, sizeof(FGuid));
+	NodeTableChecksum = FCrc::MemCrc32(NodeGuids.GetData(), NodeGuids.Num() * sizeof(FGuid), NodeTableChecksum);
+	SourceChecksum = ComputeSourceChecksum(Graph);
+}
+
+void FMounteaDialogueCompiledGraph::CompileOpenChildGraphDistances()
+{
+	const int32 nodeCount = Num();
+	OpenChildGraphDistances.Init(INDEX_NONE, nodeCount);
+
+	// Reverse adjacency in the same CSR layout, so the search walks from Open Child Graph Nodes to their parents
+	TArray<int32> parentOffsets;
+	parentOffsets.Init(0, nodeCount + 1);
+	for (const int32 childIndex : ChildIndices)
+	{
+		if (IsValidNodeIndex(childIndex))
+			++parentOffsets[childIndex + 1];
+	}
+	for (int32 i = 0; i < nodeCount; ++i)
+		parentOffsets[i + 1] += parentOffsets[i];
+
+	TArray<int32> parentIndices;
+	parentIndices.SetNumUninitialized(parentOffsets[nodeCount]);
+	TArray<int32> writeOffsets = parentOffsets;
+	for (int32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+	{
+		for (const int32 childIndex : GetChildIndices(nodeIndex))
+		{
+			if (IsValidNodeIndex(childIndex))
+				parentIndices[writeOffsets[childIndex]++] = nodeIndex;
+		}
+	}
+
+	TArray<int32> openQueue;
+	for (int32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+	{
+		if (NodeTypes[nodeIndex] == EMounteaDialogueCompiledNodeType::OpenChildGraph)
+		{
+			OpenChildGraphDistances[nodeIndex] = 0;
+			openQueue.Add(nodeIndex);
+		}
+	}
+
+	for (int32 queueIndex = 0; queueIndex < openQueue.Num(); ++queueIndex)
+	{
+		const int32 nodeIndex = openQueue[queueIndex];
+		const int32 parentDistance = OpenChildGraphDistances[nodeIndex] + 1;
+		for (int32 i = parentOffsets[nodeIndex]; i < parentOffsets[nodeIndex + 1]; ++i)
+		{
+			const int32 parentIndex = parentIndices[i];
+			if (OpenChildGraphDistances[parentIndex] != INDEX_NONE)
+				continue;
+
+			OpenChildGraphDistances[parentIndex] = parentDistance;
+			openQueue.Add(parentIndex);
+		}
+	}
+}
+
+void FMounteaDialogueCompiledGraph::Reset()
+{
+	NodeGuids.Reset();
+	NodeTypes.Reset();
+	ExecutionOrders.Reset();
+	SpeechTableIndices.Reset();
+	SpeechRowNames.Reset();
+	SpeechTables.Reset();
+	ChildOffsets.Reset();
+	ChildIndices.Reset();
+	ConditionOffsets.Reset();
+	ConditionModes.Reset();
+	ConditionRuleIndices.Reset();
+	ConditionOps.Reset();
+	OpenChildGraphDistances.Reset();
+	StartNodeIndex = INDEX_NONE;
+	NodeTableChecksum = 0;
+	SourceChecksum = 0;
+}
+
+void FMounteaDialogueCompiledGraph::CompileConditionOps(const UMounteaDialogueGraph& Graph)
+{
+	ConditionOps.Reset(ConditionRuleIndices.Num());
+
+	TArray<FMounteaDialogueCondition, TInlineAllocator<8>> slotRules;
+	for (int32 nodeIndex = 0; nodeIndex < Num(); ++nodeIndex)
+	{
+		const UMounteaDialogueGraphNode* node = Graph.AllNodes.IsValidIndex(nodeIndex) ? Graph.AllNodes[nodeIndex] : nullptr;
+		for (int32 slot = GetChildSlotBegin(nodeIndex); slot < GetChildSlotEnd(nodeIndex); ++slot)
+		{
+			const UMounteaDialogueGraphEdge* edge = node ? node->GetChildEdge(slot - GetChildSlotBegin(nodeIndex)) : nullptr;
+
+			// CompileConditionRules appends one step per rule, missing rules stay as empty steps to keep slots aligned
+			slotRules.Reset();
+			for (int32 i = ConditionOffsets[slot]; i < ConditionOffsets[slot + 1]; ++i)
+			{
+				const int32 ruleIndex = ConditionRuleIndices[i];
+				slotRules.Add(edge && edge->EdgeConditions.Rules.IsValidIndex(ruleIndex) ? edge->EdgeConditions.Rules[ruleIndex] : FMounteaDialogueCondition());
+			}
+			UMounteaDialogueConditionsStatics::CompileConditionRules(slotRules, ConditionOps);
+		}
+	}
+}
+
+bool FMounteaDialogueCompiledGraph::ReferencesAnyCondition(const TMap<UObject*, UObject*>& ReplacedObjects) const
+{
+	for (const FMounteaDialogueConditionOp& conditionOp : ConditionOps)
+	{
+		if (conditionOp.Condition && ReplacedObjects.Contains(conditionOp.Condition.Get()))
+			return true;
+	}
+
+	return false;
+}
+
+void FMounteaDialogueCompiledGraph::Startup()
+{
+#if WITH_EDITOR
+	if (!ObjectsReplacedHandle.IsValid())
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddStatic(&FMounteaDialogueCompiledGraph::RecompileConditionOps);
+#endif
+}
+
+void FMounteaDialogueCompiledGraph::Shutdown()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+	ObjectsReplacedHandle.Reset();
+}
+
+void FMounteaDialogueCompiledGraph::RecompileConditionOps(const TMap<UObject*, UObject*>& ReplacedObjects)
+{
+#if WITH_EDITOR
+	if (ReplacedObjects.IsEmpty())
+		return;
+
+	for (TObjectIterator<UMounteaDialogueGraph> graphIt; graphIt; ++graphIt)
+	{
+		if (graphIt->GetCompiledGraph().ReferencesAnyCondition(ReplacedObjects))
+			graphIt->RecompileConditionOps();
+	}
+#endif
+}
+
+bool FMounteaDialogueCompiledGraph::IsUpToDate(const UMounteaDialogueGraph& Graph) const
+{
+	return NodeGuids.Num() == Graph.AllNodes.Num()
+		&& ChildOffsets.Num() == NodeGuids.Num() + 1
+		&& ConditionOffsets.Num() == ChildIndices.Num() + 1
+		&& SourceChecksum == ComputeSourceChecksum(Graph);
+}
+
+bool FMounteaDialogueCompiledGraph::GetSpeechRowHandle(const int32 NodeIndex, UDataTable*& OutTable, FName& OutRowName) const
+{
+	OutTable = nullptr;
+	OutRowName = NAME_None;
+
+	if (!IsValidNodeIndex(NodeIndex))
+		return false;
+
+	const int32 tableIndex = SpeechTableIndices[NodeIndex];
+	if (!SpeechTables.IsValidIndex(tableIndex))
+		return false;
+
+	OutTable = SpeechTables[tableIndex];
+	OutRowName = SpeechRowNames[NodeIndex];
+	return OutTable != nullptr && !OutRowName.IsNone();
+}
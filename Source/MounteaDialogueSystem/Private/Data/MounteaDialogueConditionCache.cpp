@@ -0,0 +1,55 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueConditionCache.h"
+
+#include "Conditions/MounteaDialogueConditionBase.h"
+
+const bool* FMounteaDialogueConditionCache::Find(const UMounteaDialogueConditionBase* Condition, const EMounteaDialogueConditionCaching Caching, const FMounteaDialogueConditionRevision& Revision)
+{
+	if (Revision != CachedRevision)
+	{
+		ContextResults.Reset();
+		CachedRevision = Revision;
+	}
+
+	switch (Caching)
+	{
+		case EMounteaDialogueConditionCaching::Pure:
+			return PureResults.Find(Condition);
+		case EMounteaDialogueConditionCaching::Context:
+			return ContextResults.Find(Condition);
+		default:
+			return nullptr;
+	}
+}
+
+void FMounteaDialogueConditionCache::Add(const UMounteaDialogueConditionBase* Condition, const EMounteaDialogueConditionCaching Caching, const bool bResult)
+{
+	switch (Caching)
+	{
+		case EMounteaDialogueConditionCaching::Pure:
+			PureResults.Add(Condition, bResult);
+			break;
+		case EMounteaDialogueConditionCaching::Context:
+			ContextResults.Add(Condition, bResult);
+			break;
+		default:
+			break;
+	}
+}
+
+void FMounteaDialogueConditionCache::Reset()
+{
+	CachedRevision = FMounteaDialogueConditionRevision();
+	ContextResults.Reset();
+	PureResults.Reset();
+}
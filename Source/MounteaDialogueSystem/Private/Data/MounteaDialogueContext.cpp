@@ -55,13 +55,18 @@ bool UMounteaDialogueContext::IsValid() const
 	return ActiveNode != nullptr && DialogueParticipants.Num() > 0;
 }
 
-void UMounteaDialogueContext::SetDialogueContext(UMounteaDialogueGraphNode* NewActiveNode, TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
+void UMounteaDialogueContext::SetDialogueContext(UMounteaDialogueGraphNode* NewActiveNode, TConstArrayView<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
 {
 	if (ActiveNode && ActiveNode->GetNodeGUID() != PreviousActiveNode)
 		PreviousActiveNode = ActiveNode->GetNodeGUID();
 
 	ActiveNode = NewActiveNode;
-	AllowedChildNodes = NewAllowedChildNodes;
+	MarkConditionStateChanged();
+
+	// Reset keeps the allocation, so switching Nodes does not reallocate the list
+	AllowedChildNodes.Reset(NewAllowedChildNodes.Num());
+	for (UMounteaDialogueGraphNode* allowedChildNode : NewAllowedChildNodes)
+		AllowedChildNodes.Add(allowedChildNode);
 }
 
 void UMounteaDialogueContext::UpdateActiveDialogueNode(UMounteaDialogueGraphNode* NewActiveNode)
@@ -72,13 +77,16 @@ void UMounteaDialogueContext::UpdateActiveDialogueNode(UMounteaDialogueGraphNode
 	}
 	
 	ActiveNode = NewActiveNode;
+	MarkConditionStateChanged();
 
 	OnDialogueContextUpdated.Broadcast();
 }
 
-void UMounteaDialogueContext::UpdateAllowedChildrenNodes(const TArray<UMounteaDialogueGraphNode*>& NewNodes)
+void UMounteaDialogueContext::UpdateAllowedChildrenNodes(TConstArrayView<UMounteaDialogueGraphNode*> NewNodes)
 {
-	AllowedChildNodes = NewNodes;
+	AllowedChildNodes.Reset(NewNodes.Num());
+	for (UMounteaDialogueGraphNode* allowedChildNode : NewNodes)
+		AllowedChildNodes.Add(allowedChildNode);
 }
 
 void UMounteaDialogueContext::UpdateActiveDialogueTable(const FDataTableRowHandle& NewHandle)
@@ -102,6 +110,7 @@ void UMounteaDialogueContext::SetActiveDialogueParticipant(const TScriptInterfac
 		return;
 
 	ActiveDialogueParticipant = NewParticipant;
+	MarkConditionStateChanged();
 
 	OnDialogueContextUpdated.Broadcast();
 }
@@ -112,26 +121,9 @@ void UMounteaDialogueContext::AddTraversedNode(const UMounteaDialogueGraphNode*
 	{
 		return;
 	}
-	
-	FDialogueTraversePath* ExistingRow = TraversedPath.FindByPredicate([&](FDialogueTraversePath& Path)
-	{
-		return Path.NodeGuid == TraversedNode->GetNodeGUID() && Path.GraphGuid == TraversedNode->GetGraphGUID();
-	});
 
-	if (ExistingRow)
-	{
-		ExistingRow->TraverseCount++;
-	}
-	else
-	{
-		FDialogueTraversePath NewRow;
-		{
-			NewRow.NodeGuid = TraversedNode->GetNodeGUID();
-			NewRow.GraphGuid = TraversedNode->GetGraphGUID();
-			NewRow.TraverseCount = 1;
-		}
-		TraversedPath.Add(NewRow);
-	}
+	MarkConditionStateChanged();
+	TraversedPathIndex.Add(TraversedPath, TraversedNode->GetNodeGUID(), TraversedNode->GetGraphGUID());
 }
 
 bool UMounteaDialogueContext::AddDialogueParticipants(const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants)
@@ -154,6 +146,7 @@ bool UMounteaDialogueContext::AddDialogueParticipant(const TScriptInterface<IMou
 	}
 
 	DialogueParticipants.Add(NewParticipant);
+	MarkConditionStateChanged();
 	return true;
 }
 
@@ -174,6 +167,7 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 	if (DialogueParticipants.Contains(NewParticipant))
 	{
 		DialogueParticipants.Remove(NewParticipant);
+		MarkConditionStateChanged();
 		return true;
 	}
 
@@ -183,6 +177,14 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 void UMounteaDialogueContext::ClearDialogueParticipants()
 {
 	DialogueParticipants.Empty();
+	MarkConditionStateChanged();
+}
+
+FMounteaDialogueConditionCache* UMounteaDialogueContext::GetConditionCache(FMounteaDialogueConditionRevision& OutRevision) const
+{
+	OutRevision.ContextVersion = ConditionRevision;
+	OutRevision.TraversedPathRevision = 0;
+	return &ConditionCache;
 }
 
 void UMounteaDialogueContext::SetDialogueContextBP(UMounteaDialogueGraphNode* NewActiveNode, TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
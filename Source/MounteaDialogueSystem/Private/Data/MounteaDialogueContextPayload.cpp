@@ -10,14 +10,82 @@
 // For more information, visit: https://mountea.tools
 
 #include "Data/MounteaDialogueContextPayload.h"
+#include "Components/MounteaDialogueSession.h"
+#include "Data/MounteaDialogueRowCache.h"
+#include "Engine/DataTable.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetSerialization.h"
+#include "Engine/PackageMapClient.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueParticipantStatics.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Serialization/BitReader.h"
 #include "Sound/SoundBase.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
+#include "UObject/CoreNet.h"
+
+namespace MounteaDialoguePayloadField
+{
+	// Bit order of the dirty field mask, new groups must be appended.
+	enum Type : int32
+	{
+		SessionGUID,
+		ActiveNodeGUID,
+		PreviousNodeGUID,
+		AllowedChildNodeGUIDs,
+		ActiveGraphGUID,
+		ActiveDialogueParticipant,
+		DialogueParticipants,
+		ActiveDialogueRow,
+		ActiveDialogueRowDataIndex,
+		Count
+	};
+}
+
+static_assert(MounteaDialoguePayloadField::Count == FMounteaDialogueContextPayload::DeltaFieldCount, "Delta field count mismatch.");
+
+static constexpr uint32 AllPayloadFieldsMask = (1u << MounteaDialoguePayloadField::Count) - 1;
+
+/**
+ * Snapshot of the field versions a connection was sent, used as delta base.
+ * Holds no object references, so it is safe to keep around in the replication history.
+ */
+class FMounteaDialogueContextPayloadDeltaState : public INetDeltaBaseState
+{
+public:
+
+	explicit FMounteaDialogueContextPayloadDeltaState(const FMounteaDialogueContextPayload& Payload)
+		: ContextVersion(Payload.ContextVersion)
+	{
+		FMemory::Memcpy(FieldVersions, Payload.FieldVersions, sizeof(FieldVersions));
+	}
+
+	virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+	{
+		const FMounteaDialogueContextPayloadDeltaState* otherState = static_cast<FMounteaDialogueContextPayloadDeltaState*>(OtherState);
+		return otherState
+			&& otherState->ContextVersion == ContextVersion
+			&& FMemory::Memcmp(otherState->FieldVersions, FieldVersions, sizeof(FieldVersions)) == 0;
+	}
+
+	int32 ContextVersion = 0;
+	int32 FieldVersions[FMounteaDialogueContextPayload::DeltaFieldCount] = {};
+};
 
 static TScriptInterface<IMounteaDialogueParticipantInterface> ResolveParticipantFromActorInternal(AActor* ParticipantActor)
 {
+	const UWorld* world = ParticipantActor ? ParticipantActor->GetWorld() : nullptr;
+	if (UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+		return subsystem->ResolveCachedParticipant(ParticipantActor);
+
 	bool bFoundParticipant = false;
 	TScriptInterface<IMounteaDialogueParticipantInterface> participantInterface =
 		UMounteaDialogueParticipantStatics::ResolveParticipantFromActor(ParticipantActor, bFoundParticipant);
@@ -74,38 +142,51 @@ static void SerializeParticipantInterfaces(
 	}
 }
 
-bool FMounteaDialogueContextPayload::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+static bool AreParticipantsEqual(
+	const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& A,
+	const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& B)
 {
-	if (!Map)
-	{
-		bOutSuccess = false;
+	if (A.Num() != B.Num())
 		return false;
+
+	for (int32 index = 0; index < A.Num(); index++)
+	{
+		if (A[index].GetObject() != B[index].GetObject())
+			return false;
 	}
 
-	Ar << SessionGUID;
-	Ar << ActiveNodeGUID;
-	Ar << PreviousNodeGUID;
-	Ar << AllowedChildNodeGUIDs;
-	Ar << ActiveGraphGUID;
-	SerializeParticipantInterface(Ar, Map, ActiveDialogueParticipant);
-	SerializeParticipantInterfaces(Ar, Map, DialogueParticipants);
+	return true;
+}
+
+// FDialogueRow assignment regenerates RowGUID, so rows are compared by content instead
+static bool IsSameRowContent(const FDialogueRow& A, const FDialogueRow& B)
+{
+	return A.RowData == B.RowData
+		&& A.UIRowID == B.UIRowID
+		&& A.DialogueParticipantName == B.DialogueParticipantName
+		&& A.RowTitle.IdenticalTo(B.RowTitle)
+		&& A.DialogueRowAdditionalData == B.DialogueRowAdditionalData
+		&& A.CompatibleTags == B.CompatibleTags;
+}
 
+static void SerializeDialogueRow(FArchive& Ar, UPackageMap* Map, FDialogueRow& Row, bool& bOutSuccess)
+{
 	// FDialogueRow — field-by-field
-	ActiveDialogueRow.CompatibleTags.NetSerialize(Ar, Map, bOutSuccess);
-	Ar << ActiveDialogueRow.UIRowID;
-	Ar << ActiveDialogueRow.DialogueParticipantName;
-	Ar << ActiveDialogueRow.RowTitle;
+	Row.CompatibleTags.NetSerialize(Ar, Map, bOutSuccess);
+	Ar << Row.UIRowID;
+	Ar << Row.DialogueParticipantName;
+	Ar << Row.RowTitle;
 
 	// TArray<FDialogueRowData> — each item serialized field-by-field due to UObject refs
 	{
-	int32 dataCount = ActiveDialogueRow.RowData.Num();
+		int32 dataCount = Row.RowData.Num();
 		Ar << dataCount;
 		if (Ar.IsLoading())
-	ActiveDialogueRow.RowData.SetNum(dataCount);
+			Row.RowData.SetNum(dataCount);
 
 		for (int32 i = 0; i < dataCount; i++)
 		{
-		FDialogueRowData& dialogueRowData = ActiveDialogueRow.RowData[i];
+			FDialogueRowData& dialogueRowData = Row.RowData[i];
 			Ar << dialogueRowData.RowText;
 
 			UObject* soundAsset = dialogueRowData.RowSound;
@@ -132,17 +213,840 @@ bool FMounteaDialogueContextPayload::NetSerialize(FArchive& Ar, UPackageMap* Map
 
 	// DialogueRowAdditionalData — static data asset, loaded on both client and server
 	{
-		UObject* additionalData = ActiveDialogueRow.DialogueRowAdditionalData;
+		UObject* additionalData = Row.DialogueRowAdditionalData;
 		Map->SerializeObject(Ar, UObject::StaticClass(), additionalData);
 		if (Ar.IsLoading())
-			ActiveDialogueRow.DialogueRowAdditionalData = Cast<UDialogueAdditionalData>(additionalData);
+			Row.DialogueRowAdditionalData = Cast<UDialogueAdditionalData>(additionalData);
 	}
 
-	Ar << ActiveDialogueRow.RowGUID;
+	Ar << Row.RowGUID;
+}
 
-	Ar << ActiveDialogueRowDataIndex;
-	Ar << ContextVersion;
+static UWorld* GetPackageMapWorld(UPackageMap* Map)
+{
+	UPackageMapClient* packageMapClient = Cast<UPackageMapClient>(Map);
+	UNetConnection* connection = packageMapClient ? packageMapClient->GetConnection() : nullptr;
+	return connection ? connection->GetWorld() : nullptr;
+}
+
+// Returns true if the server may send rows of the Data Table as handles for the connection the Package Map belongs to.
+static bool CanUseRowHandle(UPackageMap* Map, const UDataTable* Table)
+{
+	UPackageMapClient* packageMapClient = Cast<UPackageMapClient>(Map);
+	UNetConnection* connection = packageMapClient ? packageMapClient->GetConnection() : nullptr;
+	const UWorld* world = connection ? connection->GetWorld() : nullptr;
+	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	return !subsystem || !subsystem->IsFullRowRequired(connection, Table);
+}
+
+/**
+ * Serializes ActiveDialogueRow as its Data Table handle when available, full row otherwise.
+ * Row GUID travels with the handle, so both sides keep the same row identity.
+ */
+static void SerializeActiveDialogueRow(FArchive& Ar, UPackageMap* Map, FMounteaDialogueContextPayload& Payload, bool& bOutSuccess)
+{
+	uint8 bHasRowHandle = Payload.ActiveRowTable != nullptr
+		&& !Payload.ActiveRowName.IsNone()
+		&& (Ar.IsLoading() || CanUseRowHandle(Map, Payload.ActiveRowTable));
+	Ar.SerializeBits(&bHasRowHandle, 1);
+
+	if (!bHasRowHandle)
+	{
+		SerializeDialogueRow(Ar, Map, Payload.ActiveDialogueRow, bOutSuccess);
+		if (Ar.IsLoading())
+		{
+			Payload.ActiveRowTable = nullptr;
+			Payload.ActiveRowName = NAME_None;
+			Payload.bActiveRowUnresolved = false;
+		}
+		return;
+	}
+
+	UObject* rowTable = Payload.ActiveRowTable;
+	Map->SerializeObject(Ar, UDataTable::StaticClass(), rowTable);
+	UPackageMap::StaticSerializeName(Ar, Payload.ActiveRowName);
+	Ar << Payload.ActiveDialogueRow.RowGUID;
+
+	if (!Ar.IsLoading())
+		return;
+
+	Payload.ActiveRowTable = Cast<UDataTable>(rowTable);
+
+	const FGuid rowGuid = Payload.ActiveDialogueRow.RowGUID;
+	const TSharedPtr<const FDialogueRow> cachedRow = FMounteaDialogueRowCache::FindRow(Payload.ActiveRowTable, Payload.ActiveRowName);
+	if (cachedRow.IsValid())
+	{
+		Payload.ActiveDialogueRow = *cachedRow;
+	}
+	else
+	{
+		LOG_WARNING(TEXT("[Context Payload] Unable to resolve replicated Dialogue Row '%s' from '%s'."), *Payload.ActiveRowName.ToString(), *GetNameSafe(rowTable))
+		Payload.ActiveDialogueRow = FDialogueRow::Invalid();
+	}
+	Payload.ActiveDialogueRow.RowGUID = rowGuid;
+
+	// Unmapped Data Table is read again once it maps, a Data Table without the row needs the full row from the server
+	Payload.bActiveRowUnresolved = !cachedRow.IsValid() && Payload.ActiveRowTable != nullptr;
+}
+
+/**
+ * Returns the resident Graph Node indices are resolved against while loading, null if it is not resident.
+ * ❗ Node table of the returned Graph might still differ from the server one.
+ */
+static UMounteaDialogueGraph* ResolveAddressingGraph(UPackageMap* Map, const FGuid& GraphGUID)
+{
+	const UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(GetPackageMapWorld(Map));
+	UMounteaDialogueGraph* graph = graphRegistry ? graphRegistry->FindGraph(GraphGUID) : nullptr;
+	return IsValid(graph) ? graph : nullptr;
+}
+
+// Returns true if the server may address Nodes of the Graph by index for the connection the Package Map belongs to.
+static bool CanUseNodeAddressing(UPackageMap* Map, const FGuid& GraphGUID)
+{
+	UPackageMapClient* packageMapClient = Cast<UPackageMapClient>(Map);
+	UNetConnection* connection = packageMapClient ? packageMapClient->GetConnection() : nullptr;
+	const UWorld* world = connection ? connection->GetWorld() : nullptr;
+	const UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	return !subsystem || !subsystem->IsGuidAddressingRequired(connection, GraphGUID);
+}
+
+/**
+ * Serializes a single Node reference as packed Node index when addressing is active, as GUID otherwise.
+ * Received index is kept in NodeIndex, so it can be resolved later if the Graph is not resident yet.
+ *
+ * @return False if a received Node index could not be resolved.
+ */
+static bool SerializeNodeReference(FArchive& Ar, UMounteaDialogueGraph* AddressingGraph, const bool bAddressingActive, FGuid& NodeGUID, int32& NodeIndex)
+{
+	uint8 bIndexed = bAddressingActive && NodeIndex != INDEX_NONE;
+	Ar.SerializeBits(&bIndexed, 1);
+
+	if (!bIndexed)
+	{
+		Ar << NodeGUID;
+		if (Ar.IsLoading())
+			NodeIndex = INDEX_NONE;
+		return true;
+	}
+
+	uint32 packedIndex = static_cast<uint32>(NodeIndex);
+	Ar.SerializeIntPacked(packedIndex);
+
+	if (!Ar.IsLoading())
+		return true;
+
+	NodeIndex = static_cast<int32>(packedIndex);
+	NodeGUID = AddressingGraph ? AddressingGraph->GetCompiledGraph().GetNodeGuid(NodeIndex) : FGuid();
+	return NodeGUID.IsValid();
+}
+
+static bool SerializeNodeReferences(FArchive& Ar, UMounteaDialogueGraph* AddressingGraph, const bool bAddressingActive, TArray<FGuid>& NodeGUIDs, TArray<int32>& NodeIndices)
+{
+	uint8 bIndexed = bAddressingActive && NodeIndices.Num() == NodeGUIDs.Num() && !NodeIndices.Contains(INDEX_NONE);
+	Ar.SerializeBits(&bIndexed, 1);
+
+	if (!bIndexed)
+	{
+		Ar << NodeGUIDs;
+		if (Ar.IsLoading())
+			NodeIndices.Reset();
+		return true;
+	}
+
+	uint32 nodeCount = static_cast<uint32>(NodeGUIDs.Num());
+	Ar.SerializeIntPacked(nodeCount);
+	if (Ar.IsLoading())
+	{
+		if (nodeCount > 1024)
+		{
+			Ar.SetError();
+			return false;
+		}
+		NodeGUIDs.SetNum(nodeCount);
+		NodeIndices.SetNum(nodeCount);
+	}
+
+	bool bResolved = true;
+	for (uint32 i = 0; i < nodeCount; i++)
+	{
+		uint32 packedIndex = Ar.IsLoading() ? 0 : static_cast<uint32>(NodeIndices[i]);
+		Ar.SerializeIntPacked(packedIndex);
+		if (Ar.IsLoading())
+		{
+			NodeIndices[i] = static_cast<int32>(packedIndex);
+			NodeGUIDs[i] = AddressingGraph ? AddressingGraph->GetCompiledGraph().GetNodeGuid(NodeIndices[i]) : FGuid();
+			bResolved &= NodeGUIDs[i].IsValid();
+		}
+	}
+
+	return bResolved;
+}
+
+static void SerializeObjectField(FArchive& Ar, UPackageMap* Map, FMounteaDialogueContextPayload& Payload, const int32 Field, bool& bOutSuccess)
+{
+	using namespace MounteaDialoguePayloadField;
+
+	switch (Field)
+	{
+		case ActiveDialogueParticipant:
+			SerializeParticipantInterface(Ar, Map, Payload.ActiveDialogueParticipant);
+			break;
+		case DialogueParticipants:
+			SerializeParticipantInterfaces(Ar, Map, Payload.DialogueParticipants);
+			break;
+		case ActiveDialogueRow:
+			SerializeActiveDialogueRow(Ar, Map, Payload, bOutSuccess);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * Reads an object bearing field group on the client.
+ * If any of its references is not mapped yet, received bits are kept so the field can be read again once they map.
+ */
+static void ReceiveObjectField(FBitReader& Reader, UPackageMap* Map, FMounteaDialogueContextPayload& Payload, const int32 Field, bool& bOutSuccess)
+{
+	Map->ResetTrackedGuids(true);
+	FBitReaderMark fieldMark(Reader);
+	SerializeObjectField(Reader, Map, Payload, Field, bOutSuccess);
+
+	// Newly received value replaces whatever was waiting for its references
+	Payload.UnmappedFields.RemoveAll([Field](const FMounteaDialoguePayloadUnmappedField& UnmappedField)
+	{
+		return UnmappedField.Field == Field;
+	});
+
+	const TSet<FNetworkGUID>& unmappedGuids = Map->GetTrackedUnmappedGuids();
+	const TSet<FNetworkGUID>& dynamicGuids = Map->GetTrackedDynamicMappedGuids();
+	if (unmappedGuids.Num() > 0 || dynamicGuids.Num() > 0)
+	{
+		// Mapped dynamic references are kept too, they become unmapped again once their Actor leaves relevancy
+		FMounteaDialoguePayloadUnmappedField& unmappedField = Payload.UnmappedFields.AddDefaulted_GetRef();
+		unmappedField.Field = Field;
+		unmappedField.UnmappedGUIDs = unmappedGuids;
+		unmappedField.MappedDynamicGUIDs = dynamicGuids;
+		unmappedField.NumBits = Reader.GetPosBits() - fieldMark.GetPos();
+		fieldMark.Copy(Reader, unmappedField.Buffer);
+	}
+
+	Map->ResetTrackedGuids(false);
+}
+
+static bool HasUnmappedReferences(const FMounteaDialogueContextPayload& Payload)
+{
+	return Payload.UnmappedFields.ContainsByPredicate([](const FMounteaDialoguePayloadUnmappedField& UnmappedField)
+	{
+		return UnmappedField.UnmappedGUIDs.Num() > 0;
+	});
+}
+
+static void SerializePayloadFields(FArchive& Ar, UPackageMap* Map, FMounteaDialogueContextPayload& Payload, const uint32 FieldMask, bool& bOutSuccess, const bool bTrackUnmapped = false)
+{
+	using namespace MounteaDialoguePayloadField;
+
+	if (FieldMask & (1u << SessionGUID))
+		Ar << Payload.SessionGUID;
+	// Graph goes before Node references, Node indices are resolved against it
+	if (FieldMask & (1u << ActiveGraphGUID))
+		Ar << Payload.ActiveGraphGUID;
+
+	constexpr uint32 nodeReferenceMask = (1u << ActiveNodeGUID) | (1u << PreviousNodeGUID) | (1u << AllowedChildNodeGUIDs);
+	if (FieldMask & nodeReferenceMask)
+	{
+		uint8 bAddressingActive = Ar.IsSaving()
+			&& Payload.NodeTableChecksum != 0
+			&& CanUseNodeAddressing(Map, Payload.ActiveGraphGUID);
+		Ar.SerializeBits(&bAddressingActive, 1);
+
+		UMounteaDialogueGraph* addressingGraph = nullptr;
+		bool bGraphResident = true;
+		if (bAddressingActive)
+		{
+			uint32 nodeTableChecksum = Payload.NodeTableChecksum;
+			Ar << nodeTableChecksum;
+			if (Ar.IsLoading())
+			{
+				// Received indices are resolved once a Graph which is not resident yet streams in
+				Payload.NodeTableChecksum = nodeTableChecksum;
+				addressingGraph = ResolveAddressingGraph(Map, Payload.ActiveGraphGUID);
+				bGraphResident = addressingGraph != nullptr;
+				if (addressingGraph && addressingGraph->GetCompiledGraph().GetNodeTableChecksum() != nodeTableChecksum)
+					addressingGraph = nullptr;
+			}
+		}
+
+		bool bResolved = true;
+		if (FieldMask & (1u << ActiveNodeGUID))
+			bResolved &= SerializeNodeReference(Ar, addressingGraph, bAddressingActive, Payload.ActiveNodeGUID, Payload.ActiveNodeIndex);
+		if (FieldMask & (1u << PreviousNodeGUID))
+			bResolved &= SerializeNodeReference(Ar, addressingGraph, bAddressingActive, Payload.PreviousNodeGUID, Payload.PreviousNodeIndex);
+		if (FieldMask & (1u << AllowedChildNodeGUIDs))
+			bResolved &= SerializeNodeReferences(Ar, addressingGraph, bAddressingActive, Payload.AllowedChildNodeGUIDs, Payload.AllowedChildNodeIndices);
+
+		// Only a resident Graph with a different Node table is a mismatch, mismatch clears once every Node reference was received again
+		if (Ar.IsLoading())
+		{
+			if (!bResolved && !bGraphResident)
+				Payload.bNodeAddressingDeferred = true;
+			else if (!bResolved)
+				Payload.bNodeAddressingMismatch = true;
+			else if ((FieldMask & nodeReferenceMask) == nodeReferenceMask)
+			{
+				Payload.bNodeAddressingMismatch = false;
+				Payload.bNodeAddressingDeferred = false;
+			}
+		}
+	}
+
+	for (const int32 objectField : { ActiveDialogueParticipant, DialogueParticipants, ActiveDialogueRow })
+	{
+		if (!(FieldMask & (1u << objectField)))
+			continue;
+
+		if (bTrackUnmapped)
+			ReceiveObjectField(static_cast<FBitReader&>(Ar), Map, Payload, objectField, bOutSuccess);
+		else
+			SerializeObjectField(Ar, Map, Payload, objectField, bOutSuccess);
+	}
+
+	if (FieldMask & (1u << ActiveDialogueRowDataIndex))
+		Ar << Payload.ActiveDialogueRowDataIndex;
+}
+
+bool FMounteaDialogueContextPayload::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	if (!Map)
+	{
+		bOutSuccess = false;
+		return false;
+	}
 
 	bOutSuccess = true;
+	SerializePayloadFields(Ar, Map, *this, AllPayloadFieldsMask, bOutSuccess);
+	Ar << ContextVersion;
+
+	bOutSuccess = bOutSuccess && !Ar.IsError();
 	return true;
 }
+
+bool FMounteaDialogueContextPayload::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (!DeltaParms.Map)
+		return false;
+
+	bool bSuccess = true;
+
+	if (DeltaParms.Writer)
+	{
+		const FMounteaDialogueContextPayloadDeltaState* oldState = static_cast<const FMounteaDialogueContextPayloadDeltaState*>(DeltaParms.OldState);
+
+		uint32 dirtyMask = 0;
+		for (int32 field = 0; field < DeltaFieldCount; field++)
+		{
+			if (!oldState || oldState->FieldVersions[field] != FieldVersions[field])
+				dirtyMask |= 1u << field;
+		}
+
+		if (oldState && dirtyMask == 0 && oldState->ContextVersion == ContextVersion)
+			return false;
+
+		*DeltaParms.NewState = MakeShared<FMounteaDialogueContextPayloadDeltaState>(*this);
+
+		FBitWriter& writer = *DeltaParms.Writer;
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+		const int64 startBits = writer.GetNumBits();
+#endif
+		writer.SerializeBits(&dirtyMask, DeltaFieldCount);
+		uint32 packedVersion = static_cast<uint32>(ContextVersion);
+		writer.SerializeIntPacked(packedVersion);
+		SerializePayloadFields(writer, DeltaParms.Map, *this, dirtyMask, bSuccess);
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+		// Payload is only replicated as a property of its Session, stats are taken from the owner.
+		if (UMounteaDialogueSession* owningSession = Cast<UMounteaDialogueSession>(DeltaParms.Object))
+		{
+			FMounteaDialogueSessionStats& sessionStats = owningSession->GetSessionStats();
+			sessionStats.PayloadReplication.Count++;
+			sessionStats.PayloadReplication.Bytes += FMath::DivideAndRoundUp<int64>(writer.GetNumBits() - startBits, 8);
+		}
+#endif
+		return !writer.IsError();
+	}
+
+	if (DeltaParms.Reader)
+	{
+		FBitReader& reader = *DeltaParms.Reader;
+
+		uint32 dirtyMask = 0;
+		reader.SerializeBits(&dirtyMask, DeltaFieldCount);
+		uint32 packedVersion = 0;
+		reader.SerializeIntPacked(packedVersion);
+		if (reader.IsError())
+			return false;
+
+		ContextVersion = static_cast<int32>(packedVersion);
+		const int32 previousUnmappedFieldCount = UnmappedFields.Num();
+		SerializePayloadFields(reader, DeltaParms.Map, *this, dirtyMask, bSuccess, true);
+
+		DeltaParms.bGuidListsChanged |= previousUnmappedFieldCount > 0 || UnmappedFields.Num() > 0;
+		DeltaParms.bOutHasMoreUnmapped |= HasUnmappedReferences(*this);
+		return bSuccess && !reader.IsError();
+	}
+
+	if (DeltaParms.GatherGuidReferences)
+	{
+		for (const FMounteaDialoguePayloadUnmappedField& unmappedField : UnmappedFields)
+		{
+			DeltaParms.GatherGuidReferences->Append(unmappedField.UnmappedGUIDs);
+			DeltaParms.GatherGuidReferences->Append(unmappedField.MappedDynamicGUIDs);
+			if (DeltaParms.TrackedGuidMemoryBytes)
+				*DeltaParms.TrackedGuidMemoryBytes += unmappedField.Buffer.Num();
+		}
+		return true;
+	}
+
+	if (DeltaParms.MoveGuidToUnmapped)
+	{
+		const FNetworkGUID& netGuid = *DeltaParms.MoveGuidToUnmapped;
+		bool bFound = false;
+		for (FMounteaDialoguePayloadUnmappedField& unmappedField : UnmappedFields)
+		{
+			if (unmappedField.MappedDynamicGUIDs.Remove(netGuid) > 0)
+			{
+				unmappedField.UnmappedGUIDs.Add(netGuid);
+				bFound = true;
+			}
+		}
+		return bFound;
+	}
+
+	if (DeltaParms.bUpdateUnmappedObjects)
+	{
+		// Fields are read again from their received bits once any of their references maps
+		TArray<FMounteaDialoguePayloadUnmappedField, TInlineAllocator<3>> mappedFields;
+		for (int32 i = UnmappedFields.Num() - 1; i >= 0; --i)
+		{
+			FMounteaDialoguePayloadUnmappedField& unmappedField = UnmappedFields[i];
+			bool bMapped = false;
+			for (auto guidIt = unmappedField.UnmappedGUIDs.CreateIterator(); guidIt; ++guidIt)
+			{
+				// Broken references never map, keeping them would poll forever
+				if (DeltaParms.Map->IsGUIDBroken(*guidIt, false))
+				{
+					guidIt.RemoveCurrent();
+					continue;
+				}
+
+				if (DeltaParms.Map->GetObjectFromNetGUID(*guidIt, false))
+				{
+					unmappedField.MappedDynamicGUIDs.Add(*guidIt);
+					guidIt.RemoveCurrent();
+					bMapped = true;
+				}
+			}
+
+			if (bMapped)
+			{
+				mappedFields.Add(MoveTemp(unmappedField));
+				UnmappedFields.RemoveAt(i);
+			}
+		}
+
+		if (mappedFields.Num() > 0)
+		{
+			if (!DeltaParms.bCalledPreNetReceive && DeltaParms.Object)
+			{
+				DeltaParms.Object->PreNetReceive();
+				DeltaParms.bCalledPreNetReceive = true;
+			}
+
+			for (FMounteaDialoguePayloadUnmappedField& mappedField : mappedFields)
+			{
+				FNetBitReader fieldReader(DeltaParms.Map, mappedField.Buffer.GetData(), mappedField.NumBits);
+				ReceiveObjectField(fieldReader, DeltaParms.Map, *this, mappedField.Field, bSuccess);
+			}
+
+			bReferencesRemapped = true;
+			DeltaParms.bOutSomeObjectsWereMapped = true;
+			DeltaParms.bGuidListsChanged = true;
+		}
+
+		DeltaParms.bOutHasMoreUnmapped |= HasUnmappedReferences(*this);
+		return true;
+	}
+
+	return false;
+}
+
+void FMounteaDialogueContextPayload::StampChangedFields(const FMounteaDialogueContextPayload& Previous)
+{
+	// Enumerators share names with the members, so they are qualified here
+	namespace Field = MounteaDialoguePayloadField;
+
+	FMemory::Memcpy(FieldVersions, Previous.FieldVersions, sizeof(FieldVersions));
+
+	const auto stampField = [this](const int32 FieldIndex, const bool bChanged)
+	{
+		if (bChanged)
+			FieldVersions[FieldIndex] = ContextVersion;
+	};
+
+	stampField(Field::SessionGUID, SessionGUID != Previous.SessionGUID);
+	stampField(Field::ActiveNodeGUID, ActiveNodeGUID != Previous.ActiveNodeGUID);
+	stampField(Field::PreviousNodeGUID, PreviousNodeGUID != Previous.PreviousNodeGUID);
+	stampField(Field::AllowedChildNodeGUIDs, AllowedChildNodeGUIDs != Previous.AllowedChildNodeGUIDs);
+	stampField(Field::ActiveGraphGUID, ActiveGraphGUID != Previous.ActiveGraphGUID);
+	stampField(Field::ActiveDialogueParticipant, ActiveDialogueParticipant.GetObject() != Previous.ActiveDialogueParticipant.GetObject());
+	stampField(Field::DialogueParticipants, !AreParticipantsEqual(DialogueParticipants, Previous.DialogueParticipants));
+
+	const bool bRowChanged = !IsSameRowContent(ActiveDialogueRow, Previous.ActiveDialogueRow)
+		|| ActiveRowTable != Previous.ActiveRowTable
+		|| ActiveRowName != Previous.ActiveRowName;
+	stampField(Field::ActiveDialogueRow, bRowChanged);
+	if (!bRowChanged)
+		ActiveDialogueRow.RowGUID = Previous.ActiveDialogueRow.RowGUID;
+	stampField(Field::ActiveDialogueRowDataIndex, ActiveDialogueRowDataIndex != Previous.ActiveDialogueRowDataIndex);
+}
+
+void FMounteaDialogueContextPayload::SetSessionGUID(const FGuid& NewSessionGUID)
+{
+	if (SessionGUID == NewSessionGUID)
+		return;
+
+	SessionGUID = NewSessionGUID;
+	FieldVersions[MounteaDialoguePayloadField::SessionGUID] = ContextVersion;
+}
+
+void FMounteaDialogueContextPayload::SetActiveNode(const FGuid& NewActiveNodeGUID, const FGuid& NewActiveGraphGUID)
+{
+	namespace Field = MounteaDialoguePayloadField;
+
+	if (ActiveNodeGUID != NewActiveNodeGUID)
+	{
+		ActiveNodeGUID = NewActiveNodeGUID;
+		FieldVersions[Field::ActiveNodeGUID] = ContextVersion;
+	}
+
+	if (ActiveGraphGUID != NewActiveGraphGUID)
+	{
+		ActiveGraphGUID = NewActiveGraphGUID;
+		FieldVersions[Field::ActiveGraphGUID] = ContextVersion;
+	}
+}
+
+void FMounteaDialogueContextPayload::SetPreviousNode(const FGuid& NewPreviousNodeGUID)
+{
+	if (PreviousNodeGUID == NewPreviousNodeGUID)
+		return;
+
+	PreviousNodeGUID = NewPreviousNodeGUID;
+	FieldVersions[MounteaDialoguePayloadField::PreviousNodeGUID] = ContextVersion;
+}
+
+void FMounteaDialogueContextPayload::SetAllowedChildNodes(TConstArrayView<TObjectPtr<UMounteaDialogueGraphNode>> ChildNodes)
+{
+	int32 childCount = 0;
+	bool bChanged = false;
+	for (const UMounteaDialogueGraphNode* childNode : ChildNodes)
+	{
+		if (!::IsValid(childNode))
+			continue;
+
+		bChanged |= !AllowedChildNodeGUIDs.IsValidIndex(childCount) || AllowedChildNodeGUIDs[childCount] != childNode->GetNodeGUID();
+		childCount++;
+	}
+
+	if (!bChanged && childCount == AllowedChildNodeGUIDs.Num())
+		return;
+
+	// Reset keeps the allocation, children count rarely grows between Nodes
+	AllowedChildNodeGUIDs.Reset(childCount);
+	for (const UMounteaDialogueGraphNode* childNode : ChildNodes)
+	{
+		if (::IsValid(childNode))
+			AllowedChildNodeGUIDs.Add(childNode->GetNodeGUID());
+	}
+	FieldVersions[MounteaDialoguePayloadField::AllowedChildNodeGUIDs] = ContextVersion;
+}
+
+void FMounteaDialogueContextPayload::SetParticipants(const TScriptInterface<IMounteaDialogueParticipantInterface>& NewActiveParticipant,
+	const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants)
+{
+	namespace Field = MounteaDialoguePayloadField;
+
+	if (ActiveDialogueParticipant.GetObject() != NewActiveParticipant.GetObject())
+	{
+		ActiveDialogueParticipant = NewActiveParticipant;
+		FieldVersions[Field::ActiveDialogueParticipant] = ContextVersion;
+	}
+
+	if (!AreParticipantsEqual(DialogueParticipants, NewParticipants))
+	{
+		DialogueParticipants = NewParticipants;
+		FieldVersions[Field::DialogueParticipants] = ContextVersion;
+	}
+}
+
+void FMounteaDialogueContextPayload::SetActiveRow(const FDialogueRow& NewRow, const int32 NewRowDataIndex)
+{
+	namespace Field = MounteaDialoguePayloadField;
+
+	if (!IsSameRowContent(ActiveDialogueRow, NewRow))
+	{
+		// Assignment regenerates RowGUID, clients pick up the new one with the row
+		ActiveDialogueRow = NewRow;
+		FieldVersions[Field::ActiveDialogueRow] = ContextVersion;
+	}
+
+	if (ActiveDialogueRowDataIndex != NewRowDataIndex)
+	{
+		ActiveDialogueRowDataIndex = NewRowDataIndex;
+		FieldVersions[Field::ActiveDialogueRowDataIndex] = ContextVersion;
+	}
+}
+
+void FMounteaDialogueContextPayload::UpdateNodeAddressing(UMounteaDialogueGraph* Graph)
+{
+	NodeTableChecksum = 0;
+	ActiveNodeIndex = INDEX_NONE;
+	PreviousNodeIndex = INDEX_NONE;
+	AllowedChildNodeIndices.Reset();
+
+	if (!IsValid(Graph) || Graph->GetGraphGUID() != ActiveGraphGUID)
+		return;
+
+	NodeTableChecksum = Graph->GetCompiledGraph().GetNodeTableChecksum();
+
+	// Previous Node might belong to a parent Graph, such reference stays a GUID
+	ActiveNodeIndex = Graph->FindNodeIndexByGuid(ActiveNodeGUID);
+	PreviousNodeIndex = Graph->FindNodeIndexByGuid(PreviousNodeGUID);
+
+	AllowedChildNodeIndices.Reserve(AllowedChildNodeGUIDs.Num());
+	for (const FGuid& childNodeGuid : AllowedChildNodeGUIDs)
+		AllowedChildNodeIndices.Add(Graph->FindNodeIndexByGuid(childNodeGuid));
+}
+
+bool FMounteaDialogueContextPayload::ResolveDeferredNodeAddressing(UMounteaDialogueGraph* Graph)
+{
+	if (!bNodeAddressingDeferred)
+		return true;
+
+	bNodeAddressingDeferred = false;
+	if (!::IsValid(Graph) || Graph->GetGraphGUID() != ActiveGraphGUID || Graph->GetCompiledGraph().GetNodeTableChecksum() != NodeTableChecksum)
+	{
+		bNodeAddressingMismatch = true;
+		return false;
+	}
+
+	// References received as GUIDs keep no index, those are resolved already
+	const FMounteaDialogueCompiledGraph& compiledGraph = Graph->GetCompiledGraph();
+	const auto resolveReference = [&compiledGraph](FGuid& NodeGUID, const int32 NodeIndex)
+	{
+		if (!NodeGUID.IsValid() && NodeIndex != INDEX_NONE)
+			NodeGUID = compiledGraph.GetNodeGuid(NodeIndex);
+		return NodeGUID.IsValid() || NodeIndex == INDEX_NONE;
+	};
+
+	bool bResolved = resolveReference(ActiveNodeGUID, ActiveNodeIndex);
+	bResolved &= resolveReference(PreviousNodeGUID, PreviousNodeIndex);
+	for (int32 i = 0; i < AllowedChildNodeIndices.Num() && i < AllowedChildNodeGUIDs.Num(); i++)
+		bResolved &= resolveReference(AllowedChildNodeGUIDs[i], AllowedChildNodeIndices[i]);
+
+	bNodeAddressingMismatch = !bResolved;
+	return bResolved;
+}
+
+void FMounteaDialogueContextPayload::StampNodeReferenceFields()
+{
+	FieldVersions[MounteaDialoguePayloadField::ActiveNodeGUID] = ContextVersion;
+	FieldVersions[MounteaDialoguePayloadField::PreviousNodeGUID] = ContextVersion;
+	FieldVersions[MounteaDialoguePayloadField::AllowedChildNodeGUIDs] = ContextVersion;
+}
+
+void FMounteaDialogueContextPayload::StampActiveRowField()
+{
+	FieldVersions[MounteaDialoguePayloadField::ActiveDialogueRow] = ContextVersion;
+}
+
+void FMounteaDialogueContextPayload::UpdateActiveRowHandle(UDataTable* Table, const FName& RowName)
+{
+	UDataTable* resolvedTable = nullptr;
+	FName resolvedRowName = NAME_None;
+
+	// Rows altered at runtime (for instance by speech data overrides) must travel in full
+	if (Table && !RowName.IsNone() && Table->IsSupportedForNetworking())
+	{
+		const TSharedPtr<const FDialogueRow> cachedRow = FMounteaDialogueRowCache::FindRow(Table, RowName);
+		if (cachedRow.IsValid() && IsSameRowContent(*cachedRow, ActiveDialogueRow))
+		{
+			resolvedTable = Table;
+			resolvedRowName = RowName;
+		}
+	}
+
+	if (ActiveRowTable == resolvedTable && ActiveRowName == resolvedRowName)
+		return;
+
+	ActiveRowTable = resolvedTable;
+	ActiveRowName = resolvedRowName;
+	FieldVersions[MounteaDialoguePayloadField::ActiveDialogueRow] = ContextVersion;
+}
+
+#if !UE_BUILD_SHIPPING
+
+static UPackageMap* FindDeltaReportPackageMap(const UWorld* World)
+{
+	const UNetDriver* netDriver = World ? World->GetNetDriver() : nullptr;
+	if (!netDriver)
+		return nullptr;
+
+	if (netDriver->ServerConnection && netDriver->ServerConnection->PackageMap)
+		return netDriver->ServerConnection->PackageMap;
+
+	for (const UNetConnection* clientConnection : netDriver->ClientConnections)
+	{
+		if (clientConnection && clientConnection->PackageMap)
+			return clientConnection->PackageMap;
+	}
+
+	return nullptr;
+}
+
+static FDialogueRow MakeDeltaReportRow(const int32 RowDataCount)
+{
+	TArray<FDialogueRowData> rowData;
+	for (int32 i = 0; i < RowDataCount; i++)
+	{
+		rowData.Emplace(FText::FromString(FString::Printf(TEXT("Measured dialogue line %d, long enough to resemble a real sentence."), i)),
+			nullptr, ERowDurationMode::ERDM_Duration, 2.5f, 0.f);
+	}
+
+	return FDialogueRow(0, FText::FromString(TEXT("Measured Row")), FText::FromString(TEXT("Speaker")), rowData, nullptr, FGameplayTagContainer());
+}
+
+static bool DoesDeltaReportRoundTripMatch(const FMounteaDialogueContextPayload& Expected, const FMounteaDialogueContextPayload& Received)
+{
+	return Expected.SessionGUID == Received.SessionGUID
+		&& Expected.ActiveNodeGUID == Received.ActiveNodeGUID
+		&& Expected.PreviousNodeGUID == Received.PreviousNodeGUID
+		&& Expected.AllowedChildNodeGUIDs == Received.AllowedChildNodeGUIDs
+		&& Expected.ActiveGraphGUID == Received.ActiveGraphGUID
+		&& Expected.ActiveDialogueRow.RowGUID == Received.ActiveDialogueRow.RowGUID
+		&& Expected.ActiveDialogueRow.RowData == Received.ActiveDialogueRow.RowData
+		&& Expected.ActiveDialogueRowDataIndex == Received.ActiveDialogueRowDataIndex
+		&& Expected.ContextVersion == Received.ContextVersion;
+}
+
+/**
+ * Replays a typical dialogue through full and delta serialization and logs bytes per transition.
+ * Every delta is read back into a client side copy to verify the round trip.
+ */
+static void RunPayloadDeltaReport(UWorld* World)
+{
+	UPackageMap* packageMap = FindDeltaReportPackageMap(World);
+	if (!packageMap)
+	{
+		LOG_WARNING(TEXT("[Payload Delta Report] Requires a net connection, run it in a networked session (for instance Listen Server with one Client)."))
+		return;
+	}
+
+	const FDialogueRow leadRow = MakeDeltaReportRow(3);
+	const FDialogueRow answerRow = MakeDeltaReportRow(1);
+	const FGuid leadNodeGuid = FGuid::NewGuid();
+	const FGuid answerNodeGuid = FGuid::NewGuid();
+
+	TArray<TPair<FString, FMounteaDialogueContextPayload>> transitions;
+	FMounteaDialogueContextPayload payload;
+	payload.SessionGUID = FGuid::NewGuid();
+	payload.ActiveGraphGUID = FGuid::NewGuid();
+	payload.ActiveNodeGUID = leadNodeGuid;
+	payload.ActiveDialogueRow = leadRow;
+	transitions.Emplace(TEXT("Session start"), payload);
+
+	payload.ActiveDialogueRowDataIndex = 1;
+	transitions.Emplace(TEXT("Row Data advance"), payload);
+
+	payload.ActiveDialogueRowDataIndex = 2;
+	transitions.Emplace(TEXT("Row Data advance"), payload);
+
+	for (int32 i = 0; i < 4; i++)
+		payload.AllowedChildNodeGUIDs.Add(FGuid::NewGuid());
+	transitions.Emplace(TEXT("Options shown"), payload);
+
+	payload.PreviousNodeGUID = leadNodeGuid;
+	payload.ActiveNodeGUID = answerNodeGuid;
+	payload.ActiveDialogueRow = answerRow;
+	payload.ActiveDialogueRowDataIndex = 0;
+	payload.AllowedChildNodeGUIDs.Reset();
+	transitions.Emplace(TEXT("Node switch"), payload);
+
+	FMounteaDialogueContextPayload serverPayload;
+	FMounteaDialogueContextPayload clientPayload;
+	TSharedPtr<INetDeltaBaseState> deltaBaseState;
+	int64 totalFullBytes = 0;
+	int64 totalDeltaBytes = 0;
+	bool bAllRoundTripsMatched = true;
+
+	for (int32 index = 0; index < transitions.Num(); index++)
+	{
+		FMounteaDialogueContextPayload nextPayload = transitions[index].Value;
+		nextPayload.ContextVersion = serverPayload.ContextVersion + 1;
+		nextPayload.StampChangedFields(serverPayload);
+		const FGuid activeRowGuid = nextPayload.ActiveDialogueRow.RowGUID;
+		serverPayload = nextPayload;
+		serverPayload.ActiveDialogueRow.RowGUID = activeRowGuid;
+
+		FBitWriter fullWriter(0, true);
+		bool bFullSuccess = false;
+		serverPayload.NetSerialize(fullWriter, packageMap, bFullSuccess);
+
+		FBitWriter deltaWriter(0, true);
+		TSharedPtr<INetDeltaBaseState> newBaseState;
+		FNetDeltaSerializeInfo writeParms;
+		writeParms.Writer = &deltaWriter;
+		writeParms.Map = packageMap;
+		writeParms.OldState = deltaBaseState.Get();
+		writeParms.NewState = &newBaseState;
+		const bool bDeltaWritten = serverPayload.NetDeltaSerialize(writeParms);
+
+		bool bRoundTripMatched = !bDeltaWritten;
+		if (bDeltaWritten)
+		{
+			deltaBaseState = newBaseState;
+
+			FBitReader deltaReader(deltaWriter.GetData(), deltaWriter.GetNumBits());
+			FNetDeltaSerializeInfo readParms;
+			readParms.Reader = &deltaReader;
+			readParms.Map = packageMap;
+			bRoundTripMatched = clientPayload.NetDeltaSerialize(readParms) && DoesDeltaReportRoundTripMatch(serverPayload, clientPayload);
+		}
+		bAllRoundTripsMatched &= bRoundTripMatched;
+
+		const int64 fullBytes = fullWriter.GetNumBytes();
+		const int64 deltaBytes = bDeltaWritten ? deltaWriter.GetNumBytes() : 0;
+		totalFullBytes += fullBytes;
+		totalDeltaBytes += deltaBytes;
+
+		LOG_INFO(TEXT("[Payload Delta Report] %d. %s: full %lld bytes, delta %lld bytes, round trip %s."),
+			index + 1, *transitions[index].Key, fullBytes, deltaBytes, bRoundTripMatched ? TEXT("matched") : TEXT("MISMATCH"))
+	}
+
+	const double savedPercent = totalFullBytes > 0 ? 100.0 * (1.0 - static_cast<double>(totalDeltaBytes) / static_cast<double>(totalFullBytes)) : 0.0;
+	if (bAllRoundTripsMatched)
+	{
+		LOG_INFO(TEXT("[Payload Delta Report] Total: full %lld bytes, delta %lld bytes (%.1f%% saved)."), totalFullBytes, totalDeltaBytes, savedPercent)
+	}
+	else
+	{
+		LOG_ERROR(TEXT("[Payload Delta Report] Delta round trip does not reproduce the server payload!"))
+	}
+}
+
+static FAutoConsoleCommandWithWorld GMounteaDialoguePayloadDeltaReportCommand(
+	TEXT("Mountea.Dialogue.PayloadDeltaReport"),
+	TEXT("Serializes a typical dialogue with full and delta Context Payload serialization and logs bytes per transition. Needs a net connection."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&RunPayloadDeltaReport));
+
+#endif
@@ -0,0 +1,189 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueRowCache.h"
+
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Engine/DataTable.h"
+#include "Helpers/MounteaDialogueTraversalStatics.h"
+#include "Internationalization/Internationalization.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+#include "UObject/UObjectGlobals.h"
+
+FDelegateHandle FMounteaDialogueRowCache::PostGarbageCollectHandle;
+FDelegateHandle FMounteaDialogueRowCache::CultureChangedHandle;
+uint32 FMounteaDialogueRowCache::DurationsSerial = 1;
+float FMounteaDialogueRowCache::CachedDurationCoefficient = -1.f;
+
+TMap<TObjectKey<UDataTable>, FMounteaDialogueRowCache::FCachedTable>& FMounteaDialogueRowCache::GetCachedTables()
+{
+	static TMap<TObjectKey<UDataTable>, FCachedTable> cachedTables;
+	return cachedTables;
+}
+
+TSharedPtr<const FDialogueRow> FMounteaDialogueRowCache::FindRow(const UDataTable* Table, const FName& RowName)
+{
+	const FCachedRow* cachedRow = FindOrAddCachedRow(Table, RowName);
+	return cachedRow ? TSharedPtr<const FDialogueRow>(cachedRow->Row) : nullptr;
+}
+
+bool FMounteaDialogueRowCache::FindRowDuration(const UDataTable* Table, const FName& RowName, const int32 RowDataIndex, const FGuid& RowDataGUID, float& OutDuration)
+{
+	FCachedRow* cachedRow = FindOrAddCachedRow(Table, RowName);
+	if (!cachedRow || !cachedRow->Row->RowData.IsValidIndex(RowDataIndex))
+		return false;
+
+	// Row might have been replaced by a decorator or Blueprint, only serve durations of the very same Row Data
+	if (cachedRow->Row->RowData[RowDataIndex].RowGUID != RowDataGUID)
+		return false;
+
+	if (cachedRow->RowDurationsSerial != DurationsSerial)
+		UpdateRowDurations(*cachedRow);
+
+	OutDuration = cachedRow->RowDurations[RowDataIndex];
+	return true;
+}
+
+FMounteaDialogueRowCache::FCachedRow* FMounteaDialogueRowCache::FindOrAddCachedRow(const UDataTable* Table, const FName& RowName)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Table) || RowName.IsNone())
+		return nullptr;
+
+	if (!Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(FDialogueRow::StaticStruct()))
+		return nullptr;
+
+	const TObjectKey<UDataTable> tableKey(Table);
+	FCachedTable* cachedTable = GetCachedTables().Find(tableKey);
+	if (cachedTable)
+	{
+		if (FCachedRow* cachedRow = cachedTable->Rows.Find(RowName))
+			return cachedRow;
+	}
+
+	const FDialogueRow* tableRow = Table->FindRow<FDialogueRow>(RowName, FString(), false);
+	if (!tableRow)
+		return nullptr;
+
+	if (!cachedTable)
+	{
+		// OnDataTableChanged is only exposed on mutable tables, binding to it does not modify the table
+		UDataTable* mutableTable = const_cast<UDataTable*>(Table);
+		cachedTable = &GetCachedTables().Add(tableKey);
+		cachedTable->Table = mutableTable;
+		cachedTable->ChangedHandle = mutableTable->OnDataTableChanged().AddLambda([tableKey]()
+		{
+			if (FCachedTable* changedTable = GetCachedTables().Find(tableKey))
+				changedTable->Rows.Reset();
+		});
+	}
+
+	FCachedRow& cachedRow = cachedTable->Rows.Add(RowName, FCachedRow(MakeShared<const FDialogueRow>(*tableRow)));
+	UpdateRowDurations(cachedRow);
+	return &cachedRow;
+}
+
+void FMounteaDialogueRowCache::UpdateRowDurations(FCachedRow& CachedRow)
+{
+	const float durationCoefficient = GetDurationCoefficient();
+	const TArray<FDialogueRowData>& rowData = CachedRow.Row->RowData;
+
+	CachedRow.RowDurations.SetNumUninitialized(rowData.Num());
+	for (int32 i = 0; i < rowData.Num(); ++i)
+		CachedRow.RowDurations[i] = UMounteaDialogueTraversalStatics::CalculateRowDuration(rowData[i], durationCoefficient);
+
+	CachedRow.RowDurationsSerial = DurationsSerial;
+}
+
+float FMounteaDialogueRowCache::GetDurationCoefficient()
+{
+	if (CachedDurationCoefficient < 0.f)
+	{
+		const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
+		CachedDurationCoefficient = settings ? settings->GetDurationCoefficient() : 8.f;
+	}
+
+	return CachedDurationCoefficient;
+}
+
+TSharedRef<const FDialogueRow> FMounteaDialogueRowCache::GetInvalidRow()
+{
+	static const TSharedRef<const FDialogueRow> invalidRow = MakeShared<const FDialogueRow>(FDialogueRow::Invalid());
+	return invalidRow;
+}
+
+TSharedRef<const FDialogueRow> FMounteaDialogueRowCache::GetEmptyRow()
+{
+	static const TSharedRef<const FDialogueRow> emptyRow = MakeShared<const FDialogueRow>();
+	return emptyRow;
+}
+
+void FMounteaDialogueRowCache::InvalidateTable(const UDataTable* Table)
+{
+	if (FCachedTable* cachedTable = GetCachedTables().Find(TObjectKey<UDataTable>(Table)))
+		cachedTable->Rows.Reset();
+}
+
+void FMounteaDialogueRowCache::InvalidateRowDurations()
+{
+	// Rows recompute their durations lazily on next lookup
+	++DurationsSerial;
+	CachedDurationCoefficient = -1.f;
+}
+
+void FMounteaDialogueRowCache::Reset()
+{
+	for (auto& cachedTable : GetCachedTables())
+		ReleaseCachedTable(cachedTable.Value);
+
+	GetCachedTables().Empty();
+}
+
+void FMounteaDialogueRowCache::Startup()
+{
+	if (!PostGarbageCollectHandle.IsValid())
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FMounteaDialogueRowCache::PurgeCollectedTables);
+
+	// Automatic durations depend on the length of localized texts
+	if (!CultureChangedHandle.IsValid())
+		CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddStatic(&FMounteaDialogueRowCache::InvalidateRowDurations);
+}
+
+void FMounteaDialogueRowCache::Shutdown()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+
+	if (FInternationalization::IsAvailable())
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+	CultureChangedHandle.Reset();
+
+	Reset();
+}
+
+void FMounteaDialogueRowCache::ReleaseCachedTable(FCachedTable& CachedTable)
+{
+	if (UDataTable* table = CachedTable.Table.Get())
+		table->OnDataTableChanged().Remove(CachedTable.ChangedHandle);
+
+	CachedTable.ChangedHandle.Reset();
+	CachedTable.Rows.Reset();
+}
+
+void FMounteaDialogueRowCache::PurgeCollectedTables()
+{
+	for (auto cachedTableItr = GetCachedTables().CreateIterator(); cachedTableItr; ++cachedTableItr)
+	{
+		if (!cachedTableItr.Value().Table.IsValid())
+			cachedTableItr.RemoveCurrent();
+	}
+}
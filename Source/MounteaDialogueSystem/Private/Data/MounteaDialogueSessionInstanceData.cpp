@@ -0,0 +1,96 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueSessionInstanceData.h"
+
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
+
+int32 FMounteaDialogueSessionInstanceData::FindNodeSlot(const UMounteaDialogueGraphNode* Node, const UMounteaDialogueGraph*& OutGraph) const
+{
+	OutGraph = IsValid(Node) ? Node->GetGraph() : nullptr;
+	if (!IsValid(OutGraph))
+		return INDEX_NONE;
+
+	const int32 nodeIndex = OutGraph->FindNodeIndexByGuid(Node->GetNodeGUID());
+	if (nodeIndex == INDEX_NONE)
+		return INDEX_NONE;
+
+	const int32* graphOffset = GraphOffsets.Find(OutGraph->GetGraphGUID());
+	return graphOffset ? *graphOffset + nodeIndex : INDEX_NONE;
+}
+
+FMounteaDialogueNodeInstanceData* FMounteaDialogueSessionInstanceData::FindOrAddNodeData(const UMounteaDialogueGraphNode* Node)
+{
+	const UMounteaDialogueGraph* graph = nullptr;
+	const int32 nodeSlot = FindNodeSlot(Node, graph);
+	if (NodeData.IsValidIndex(nodeSlot))
+		return &NodeData[nodeSlot];
+
+	if (!IsValid(graph) || GraphOffsets.Contains(graph->GetGraphGUID()))
+		return nullptr;
+
+	const int32 nodeIndex = graph->FindNodeIndexByGuid(Node->GetNodeGUID());
+	if (nodeIndex == INDEX_NONE)
+		return nullptr;
+
+	const int32 graphOffset = NodeData.AddDefaulted(graph->AllNodes.Num());
+	GraphOffsets.Add(graph->GetGraphGUID(), graphOffset);
+	return &NodeData[graphOffset + nodeIndex];
+}
+
+const FMounteaDialogueNodeInstanceData* FMounteaDialogueSessionInstanceData::FindNodeData(const UMounteaDialogueGraphNode* Node) const
+{
+	const UMounteaDialogueGraph* graph = nullptr;
+	const int32 nodeSlot = FindNodeSlot(Node, graph);
+	return NodeData.IsValidIndex(nodeSlot) ? &NodeData[nodeSlot] : nullptr;
+}
+
+float FMounteaDialogueSessionInstanceData::GetDecoratorValue(const FGuid& DecoratorGUID, const FName& Key, const float DefaultValue) const
+{
+	const TMap<FName, float>* decoratorValues = DecoratorValues.Find(DecoratorGUID);
+	const float* value = decoratorValues ? decoratorValues->Find(Key) : nullptr;
+	return value ? *value : DefaultValue;
+}
+
+void FMounteaDialogueSessionInstanceData::SetDecoratorValue(const FGuid& DecoratorGUID, const FName& Key, const float Value)
+{
+	DecoratorValues.FindOrAdd(DecoratorGUID).Add(Key, Value);
+}
+
+bool FMounteaDialogueSessionInstanceData::MarkGraphDecoratorsBound(const UMounteaDialogueGraph* Graph)
+{
+	if (!IsValid(Graph))
+		return false;
+
+	bool bAlreadyBound = false;
+	BoundGraphs.Add(Graph->GetGraphGUID(), &bAlreadyBound);
+	return !bAlreadyBound;
+}
+
+void FMounteaDialogueSessionInstanceData::Reset(UWorld* World)
+{
+	if (UMounteaDialogueWorldSubsystem* subsystem = World ? World->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+	{
+		for (FMounteaDialogueNodeInstanceData& nodeData : NodeData)
+		{
+			if (nodeData.DelayTimer.IsValid())
+				subsystem->ClearDialogueTimer(nodeData.DelayTimer);
+		}
+	}
+
+	NodeData.Reset();
+	GraphOffsets.Reset();
+	DecoratorValues.Reset();
+	BoundGraphs.Reset();
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueSessionStats.h"
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+
+#include "HAL/PlatformTime.h"
+
+FMounteaDialogueSessionStats* FMounteaDialogueSessionStats::Active = nullptr;
+
+void FMounteaDialogueSessionStats::Begin(const FGuid& InSessionGUID, const FString& InGraphName)
+{
+	*this = FMounteaDialogueSessionStats();
+	SessionGUID = InSessionGUID;
+	GraphName = InGraphName;
+	StartSeconds = FPlatformTime::Seconds();
+}
+
+void FMounteaDialogueSessionStats::RecordRPC(const FName& Name, const int64 Bytes)
+{
+	FCounter& counter = RPCs.FindOrAdd(Name);
+	counter.Count++;
+	counter.Bytes += Bytes;
+}
+
+double FMounteaDialogueSessionStats::GetDurationSeconds() const
+{
+	if (!IsValid())
+		return 0.0;
+
+	return (EndSeconds > 0.0 ? EndSeconds : FPlatformTime::Seconds()) - StartSeconds;
+}
+
+double FMounteaDialogueSessionStats::GetHandlerMilliseconds() const
+{
+	uint64 cycles = 0;
+	for (const TPair<FName, FCounter>& handler : Handlers)
+		cycles += handler.Value.Cycles;
+
+	return FPlatformTime::ToMilliseconds64(cycles);
+}
+
+FString FMounteaDialogueSessionStats::GetCsvHeader()
+{
+	return TEXT("SessionGUID,Graph,Finished,DurationSeconds,Category,Name,Count,Bytes,Milliseconds\n");
+}
+
+void FMounteaDialogueSessionStats::AppendCsvRows(FString& OutCsv) const
+{
+	const FString rowPrefix = FString::Printf(TEXT("%s,%s,%d,%.3f"),
+		*SessionGUID.ToString(EGuidFormats::DigitsWithHyphens), *GraphName, EndSeconds > 0.0 ? 1 : 0, GetDurationSeconds());
+
+	const auto appendRow = [&OutCsv, &rowPrefix](const TCHAR* Category, const FString& Name, const int32 Count, const int64 Bytes, const double Milliseconds)
+	{
+		OutCsv += FString::Printf(TEXT("%s,%s,%s,%d,%lld,%.4f\n"), *rowPrefix, Category, *Name, Count, Bytes, Milliseconds);
+	};
+
+	appendRow(TEXT("Payload"), TEXT("Writes"), PayloadWrites, 0, 0.0);
+	appendRow(TEXT("Payload"), TEXT("Replication"), PayloadReplication.Count, PayloadReplication.Bytes, 0.0);
+	appendRow(TEXT("Conditions"), TEXT("Evaluations"), ConditionEvaluations, 0, 0.0);
+	appendRow(TEXT("TraversedPath"), TEXT("Entries"), TraversedPathEntries, 0, 0.0);
+
+	for (const TPair<FName, FCounter>& rpc : RPCs)
+		appendRow(TEXT("RPC"), rpc.Key.ToString(), rpc.Value.Count, rpc.Value.Bytes, 0.0);
+
+	for (const TPair<FName, FCounter>& handler : Handlers)
+		appendRow(TEXT("Handler"), handler.Key.ToString(), handler.Value.Count, 0, FPlatformTime::ToMilliseconds64(handler.Value.Cycles));
+}
+
+FString FMounteaDialogueSessionStats::ToString() const
+{
+	int32 rpcCount = 0;
+	int64 rpcBytes = 0;
+	for (const TPair<FName, FCounter>& rpc : RPCs)
+	{
+		rpcCount += rpc.Value.Count;
+		rpcBytes += rpc.Value.Bytes;
+	}
+
+	FString result = FString::Printf(TEXT("%s '%s' (%s, %.1f s): payload %d writes, %lld bytes in %d sends | %d RPCs, %lld bytes sent | %d condition evaluations | %d traversed path entries | handlers %.3f ms"),
+		*SessionGUID.ToString(), *GraphName, EndSeconds > 0.0 ? TEXT("finished") : TEXT("running"), GetDurationSeconds(),
+		PayloadWrites, PayloadReplication.Bytes, PayloadReplication.Count,
+		rpcCount, rpcBytes,
+		ConditionEvaluations,
+		TraversedPathEntries,
+		GetHandlerMilliseconds());
+
+	for (const TPair<FName, FCounter>& rpc : RPCs)
+		result += FString::Printf(TEXT("\n\tRPC %s: %d calls, %lld bytes"), *rpc.Key.ToString(), rpc.Value.Count, rpc.Value.Bytes);
+
+	for (const TPair<FName, FCounter>& handler : Handlers)
+		result += FString::Printf(TEXT("\n\t%s: %d calls, %.3f ms"), *handler.Key.ToString(), handler.Value.Count, FPlatformTime::ToMilliseconds64(handler.Value.Cycles));
+
+	return result;
+}
+
+FMounteaDialogueSessionStatsScope::FMounteaDialogueSessionStatsScope(FMounteaDialogueSessionStats& InStats, const FName& InHandlerName)
+	: Stats(InStats)
+	, PreviousActive(FMounteaDialogueSessionStats::Active)
+	, HandlerName(InHandlerName)
+	, StartCycles(FPlatformTime::Cycles64())
+{
+	FMounteaDialogueSessionStats::Active = &Stats;
+}
+
+FMounteaDialogueSessionStatsScope::~FMounteaDialogueSessionStatsScope()
+{
+	FMounteaDialogueSessionStats::FCounter& counter = Stats.Handlers.FindOrAdd(HandlerName);
+	counter.Count++;
+	counter.Cycles += FPlatformTime::Cycles64() - StartCycles;
+
+	FMounteaDialogueSessionStats::Active = PreviousActive;
+}
+
+#endif
@@ -0,0 +1,250 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Data/MounteaDialogueTimingWheel.h"
+
+FMounteaDialogueTimingWheel::FMounteaDialogueTimingWheel()
+{
+	for (int32& slotHead : SlotHeads)
+		slotHead = INDEX_NONE;
+}
+
+FMounteaDialogueTimerHandle FMounteaDialogueTimingWheel::SetTimer(const FTimerDelegate& Delegate, const float Delay)
+{
+	const int32 entryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FEntry& entry = Entries[entryIndex];
+
+	const double duration = FMath::Max(Delay, 0.f);
+	const uint64 expireTick = static_cast<uint64>(FMath::CeilToDouble((ElapsedSeconds + duration) / TickSeconds));
+
+	entry.Delegate = Delegate;
+	entry.ExpireTick = FMath::Clamp(expireTick, CurrentTick + 1, CurrentTick + MaxTicks);
+	entry.Sequence = NextSequence++;
+	entry.StartSeconds = ElapsedSeconds;
+	entry.Duration = static_cast<float>(duration);
+	entry.State = EEntryState::Scheduled;
+	LinkEntry(entryIndex);
+	ScheduledCount++;
+
+	FMounteaDialogueTimerHandle handle;
+	handle.Index = entryIndex;
+	handle.Generation = entry.Generation;
+	return handle;
+}
+
+void FMounteaDialogueTimingWheel::ClearTimer(FMounteaDialogueTimerHandle& Handle)
+{
+	if (const FEntry* entry = FindEntry(Handle))
+	{
+		if (entry->State == EEntryState::Scheduled)
+		{
+			UnlinkEntry(Handle.Index);
+			ScheduledCount--;
+		}
+
+		// Expired entries waiting in the batch are skipped once their generation changes
+		FreeEntry(Handle.Index);
+	}
+
+	Handle.Invalidate();
+}
+
+bool FMounteaDialogueTimingWheel::IsTimerActive(const FMounteaDialogueTimerHandle& Handle) const
+{
+	return FindEntry(Handle) != nullptr;
+}
+
+float FMounteaDialogueTimingWheel::GetTimerElapsed(const FMounteaDialogueTimerHandle& Handle) const
+{
+	const FEntry* entry = FindEntry(Handle);
+	return entry ? static_cast<float>(ElapsedSeconds - entry->StartSeconds) : -1.f;
+}
+
+float FMounteaDialogueTimingWheel::GetTimerRemaining(const FMounteaDialogueTimerHandle& Handle) const
+{
+	const FEntry* entry = FindEntry(Handle);
+	return entry ? FMath::Max(0.f, entry->Duration - static_cast<float>(ElapsedSeconds - entry->StartSeconds)) : -1.f;
+}
+
+void FMounteaDialogueTimingWheel::Advance(const float DeltaSeconds)
+{
+	// Callbacks run inside Advance, time must not move under them
+	if (bFiring)
+		return;
+
+	ElapsedSeconds += FMath::Max(DeltaSeconds, 0.f);
+	const uint64 targetTick = static_cast<uint64>(ElapsedSeconds / TickSeconds);
+
+	while (CurrentTick < targetTick)
+	{
+		// Empty wheel has nothing to cascade, it can jump straight to the target
+		if (ScheduledCount == 0)
+		{
+			CurrentTick = targetTick;
+			break;
+		}
+
+		StepTick();
+	}
+
+	if (ExpiredBatch.IsEmpty())
+		return;
+
+	ExpiredBatch.Sort([this](const FExpiredEntry& A, const FExpiredEntry& B)
+	{
+		const FEntry& entryA = Entries[A.Index];
+		const FEntry& entryB = Entries[B.Index];
+		return entryA.ExpireTick != entryB.ExpireTick ? entryA.ExpireTick < entryB.ExpireTick : entryA.Sequence < entryB.Sequence;
+	});
+
+	bFiring = true;
+	for (const FExpiredEntry& expired : ExpiredBatch)
+	{
+		FEntry& entry = Entries[expired.Index];
+		if (entry.Generation != expired.Generation || entry.State != EEntryState::Expired)
+			continue;
+
+		// Callback may schedule new timers and reallocate Entries, nothing of the entry is used afterwards
+		const FTimerDelegate delegate = MoveTemp(entry.Delegate);
+		FreeEntry(expired.Index);
+		delegate.ExecuteIfBound();
+	}
+	bFiring = false;
+
+	ExpiredBatch.Reset();
+}
+
+void FMounteaDialogueTimingWheel::Reset()
+{
+	for (int32 entryIndex = 0; entryIndex < Entries.Num(); ++entryIndex)
+	{
+		if (Entries[entryIndex].State != EEntryState::Free)
+			FreeEntry(entryIndex);
+	}
+
+	for (int32& slotHead : SlotHeads)
+		slotHead = INDEX_NONE;
+
+	ExpiredBatch.Reset();
+	ScheduledCount = 0;
+}
+
+const FMounteaDialogueTimingWheel::FEntry* FMounteaDialogueTimingWheel::FindEntry(const FMounteaDialogueTimerHandle& Handle) const
+{
+	if (!Handle.IsValid() || !Entries.IsValidIndex(Handle.Index))
+		return nullptr;
+
+	const FEntry& entry = Entries[Handle.Index];
+	return entry.Generation == Handle.Generation && entry.State != EEntryState::Free ? &entry : nullptr;
+}
+
+void FMounteaDialogueTimingWheel::LinkEntry(const int32 EntryIndex)
+{
+	FEntry& entry = Entries[EntryIndex];
+	const uint64 delta = entry.ExpireTick > CurrentTick ? entry.ExpireTick - CurrentTick : 0;
+
+	// Lowest level whose range still covers the delay
+	int32 level = 0;
+	while (level < LevelCount - 1 && delta >= (1ull << (SlotBits * (level + 1))))
+		level++;
+
+	const int32 slot = level * SlotCount + static_cast<int32>((entry.ExpireTick >> (SlotBits * level)) & SlotMask);
+	entry.Slot = slot;
+	entry.Prev = INDEX_NONE;
+	entry.Next = SlotHeads[slot];
+	if (entry.Next != INDEX_NONE)
+		Entries[entry.Next].Prev = EntryIndex;
+	SlotHeads[slot] = EntryIndex;
+}
+
+void FMounteaDialogueTimingWheel::UnlinkEntry(const int32 EntryIndex)
+{
+	FEntry& entry = Entries[EntryIndex];
+	if (entry.Prev != INDEX_NONE)
+		Entries[entry.Prev].Next = entry.Next;
+	else if (entry.Slot != INDEX_NONE)
+		SlotHeads[entry.Slot] = entry.Next;
+
+	if (entry.Next != INDEX_NONE)
+		Entries[entry.Next].Prev = entry.Prev;
+
+	entry.Prev = INDEX_NONE;
+	entry.Next = INDEX_NONE;
+	entry.Slot = INDEX_NONE;
+}
+
+void FMounteaDialogueTimingWheel::FreeEntry(const int32 EntryIndex)
+{
+	FEntry& entry = Entries[EntryIndex];
+	entry.Delegate.Unbind();
+	entry.State = EEntryState::Free;
+	entry.Prev = INDEX_NONE;
+	entry.Next = INDEX_NONE;
+	entry.Slot = INDEX_NONE;
+
+	// Zero generation marks invalid handles
+	entry.Generation = entry.Generation == MAX_uint32 ? 1 : entry.Generation + 1;
+	FreeEntries.Add(EntryIndex);
+}
+
+void FMounteaDialogueTimingWheel::CascadeSlot(const int32 Level, const int32 SlotIndex)
+{
+	const int32 slot = Level * SlotCount + SlotIndex;
+	int32 entryIndex = SlotHeads[slot];
+	SlotHeads[slot] = INDEX_NONE;
+
+	while (entryIndex != INDEX_NONE)
+	{
+		const int32 nextIndex = Entries[entryIndex].Next;
+		LinkEntry(entryIndex);
+		entryIndex = nextIndex;
+	}
+}
+
+void FMounteaDialogueTimingWheel::StepTick()
+{
+	CurrentTick++;
+
+	// Higher level slot reached by this step drops its timers into lower levels
+	int32 wrappedLevels = 0;
+	while (wrappedLevels < LevelCount - 1 && (CurrentTick & ((1ull << (SlotBits * (wrappedLevels + 1))) - 1)) == 0)
+		wrappedLevels++;
+
+	for (int32 level = wrappedLevels; level > 0; --level)
+		CascadeSlot(level, static_cast<int32>((CurrentTick >> (SlotBits * level)) & SlotMask));
+
+	const int32 slot = static_cast<int32>(CurrentTick & SlotMask);
+	int32 entryIndex = SlotHeads[slot];
+	SlotHeads[slot] = INDEX_NONE;
+
+	while (entryIndex != INDEX_NONE)
+	{
+		FEntry& entry = Entries[entryIndex];
+		const int32 nextIndex = entry.Next;
+		entry.Prev = INDEX_NONE;
+		entry.Next = INDEX_NONE;
+		entry.Slot = INDEX_NONE;
+
+		if (entry.ExpireTick <= CurrentTick)
+		{
+			entry.State = EEntryState::Expired;
+			ExpiredBatch.Add({ entryIndex, entry.Generation });
+			ScheduledCount--;
+		}
+		else
+		{
+			LinkEntry(entryIndex);
+		}
+
+		entryIndex = nextIndex;
+	}
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Data/MounteaDialogueTraversalIndex.h"
+
+const FDialogueTraversePath* FMounteaDialogueTraversalIndex::Find(const TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	const int32 entryIndex = FindIndex(Path, NodeGuid, GraphGuid);
+	return entryIndex != INDEX_NONE ? &Path[entryIndex] : nullptr;
+}
+
+void FMounteaDialogueTraversalIndex::Add(TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid, const int32 TraverseCount)
+{
+	const int32 entryIndex = FindIndex(Path, NodeGuid, GraphGuid);
+	if (entryIndex != INDEX_NONE)
+	{
+		Path[entryIndex].IncrementCount(TraverseCount);
+		return;
+	}
+
+	const int32 newIndex = Path.Emplace(NodeGuid, GraphGuid, TraverseCount);
+	EntryIndices.Add(TPair<FGuid, FGuid>(NodeGuid, GraphGuid), newIndex);
+}
+
+int32 FMounteaDialogueTraversalIndex::FindIndex(const TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	Validate(Path);
+
+	const TPair<FGuid, FGuid> key(NodeGuid, GraphGuid);
+	const int32* entryIndex = EntryIndices.Find(key);
+	if (!entryIndex)
+		return INDEX_NONE;
+
+	if (Path[*entryIndex].GetGuidPair() == key)
+		return *entryIndex;
+
+	// Array was rewritten without changing its size
+	EntryIndices.Reset();
+	Validate(Path);
+	entryIndex = EntryIndices.Find(key);
+	return entryIndex ? *entryIndex : INDEX_NONE;
+}
+
+void FMounteaDialogueTraversalIndex::Validate(const TArray<FDialogueTraversePath>& Path) const
+{
+	if (EntryIndices.Num() == Path.Num())
+		return;
+
+	EntryIndices.Reset();
+	EntryIndices.Reserve(Path.Num());
+	// Duplicate entries keep the first one, such arrays are indexed again on every lookup
+	for (int32 i = 0; i < Path.Num(); i++)
+		EntryIndices.FindOrAdd(Path[i].GetGuidPair(), i);
+}
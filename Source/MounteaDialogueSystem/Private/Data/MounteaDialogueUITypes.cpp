@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Data/MounteaDialogueUITypes.h"
+#include "Engine/NetSerialization.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+
+namespace MounteaDialogueUISignalEncoding
+{
+	// Upper bound of signals accepted in one batch, guards the client against malformed counts.
+	constexpr uint32 MaxBatchSignals = 256;
+
+	EMounteaDialogueUICommand ToCommandId(const FString& Command)
+	{
+		if (Command.IsEmpty())
+			return EMounteaDialogueUICommand::None;
+
+		if (Command == MounteaDialogueWidgetCommands::CreateDialogueWidget)		return EMounteaDialogueUICommand::CreateDialogueWidget;
+		if (Command == MounteaDialogueWidgetCommands::CloseDialogueWidget)		return EMounteaDialogueUICommand::CloseDialogueWidget;
+		if (Command == MounteaDialogueWidgetCommands::ShowDialogueRow)			return EMounteaDialogueUICommand::ShowDialogueRow;
+		if (Command == MounteaDialogueWidgetCommands::UpdateDialogueRow)		return EMounteaDialogueUICommand::UpdateDialogueRow;
+		if (Command == MounteaDialogueWidgetCommands::HideDialogueRow)			return EMounteaDialogueUICommand::HideDialogueRow;
+		if (Command == MounteaDialogueWidgetCommands::AddDialogueOptions)		return EMounteaDialogueUICommand::AddDialogueOptions;
+		if (Command == MounteaDialogueWidgetCommands::RemoveDialogueOptions)	return EMounteaDialogueUICommand::RemoveDialogueOptions;
+		if (Command == MounteaDialogueWidgetCommands::ShowSkipUI)				return EMounteaDialogueUICommand::ShowSkipUI;
+		if (Command == MounteaDialogueWidgetCommands::HideSkipUI)				return EMounteaDialogueUICommand::HideSkipUI;
+
+		return EMounteaDialogueUICommand::Custom;
+	}
+
+	FString ToCommand(const EMounteaDialogueUICommand CommandId)
+	{
+		switch (CommandId)
+		{
+			case EMounteaDialogueUICommand::CreateDialogueWidget:	return MounteaDialogueWidgetCommands::CreateDialogueWidget;
+			case EMounteaDialogueUICommand::CloseDialogueWidget:	return MounteaDialogueWidgetCommands::CloseDialogueWidget;
+			case EMounteaDialogueUICommand::ShowDialogueRow:		return MounteaDialogueWidgetCommands::ShowDialogueRow;
+			case EMounteaDialogueUICommand::UpdateDialogueRow:		return MounteaDialogueWidgetCommands::UpdateDialogueRow;
+			case EMounteaDialogueUICommand::HideDialogueRow:		return MounteaDialogueWidgetCommands::HideDialogueRow;
+			case EMounteaDialogueUICommand::AddDialogueOptions:		return MounteaDialogueWidgetCommands::AddDialogueOptions;
+			case EMounteaDialogueUICommand::RemoveDialogueOptions:	return MounteaDialogueWidgetCommands::RemoveDialogueOptions;
+			case EMounteaDialogueUICommand::ShowSkipUI:				return MounteaDialogueWidgetCommands::ShowSkipUI;
+			case EMounteaDialogueUICommand::HideSkipUI:				return MounteaDialogueWidgetCommands::HideSkipUI;
+			default:												return FString();
+		}
+	}
+}
+
+bool FMounteaDialogueUISignalBatch::Add(const FMounteaDialogueUISignal& Signal)
+{
+	// Only a repeat of the last signal is redundant, an earlier equal one may have been undone by signals queued since
+	if (Signals.Num() > 0)
+	{
+		const FMounteaDialogueUISignal& lastSignal = Signals.Last();
+		if (lastSignal.RequiredContextVersion == Signal.RequiredContextVersion
+			&& lastSignal.bForceReconcile == Signal.bForceReconcile
+			&& lastSignal.SessionGUID == Signal.SessionGUID
+			&& lastSignal.Command == Signal.Command)
+			return false;
+	}
+
+	Signals.Add(Signal);
+	return true;
+}
+
+bool FMounteaDialogueUISignalBatch::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint32 signalCount = Ar.IsSaving() ? static_cast<uint32>(Signals.Num()) : 0;
+	Ar.SerializeIntPacked(signalCount);
+	if (Ar.IsLoading())
+	{
+		if (signalCount > MounteaDialogueUISignalEncoding::MaxBatchSignals)
+		{
+			bOutSuccess = false;
+			return false;
+		}
+		Signals.SetNum(signalCount);
+	}
+
+	FGuid previousSessionGUID;
+	for (FMounteaDialogueUISignal& signal : Signals)
+	{
+		uint8 bSessionChanged = signal.SessionGUID != previousSessionGUID;
+		Ar.SerializeBits(&bSessionChanged, 1);
+		if (bSessionChanged)
+			Ar << signal.SessionGUID;
+		else if (Ar.IsLoading())
+			signal.SessionGUID = previousSessionGUID;
+		previousSessionGUID = signal.SessionGUID;
+
+		uint8 commandId = static_cast<uint8>(Ar.IsSaving() ? MounteaDialogueUISignalEncoding::ToCommandId(signal.Command) : EMounteaDialogueUICommand::None);
+		Ar << commandId;
+		if (commandId > static_cast<uint8>(EMounteaDialogueUICommand::Custom))
+		{
+			bOutSuccess = false;
+			return false;
+		}
+
+		if (commandId == static_cast<uint8>(EMounteaDialogueUICommand::Custom))
+			Ar << signal.Command;
+		else if (Ar.IsLoading())
+			signal.Command = MounteaDialogueUISignalEncoding::ToCommand(static_cast<EMounteaDialogueUICommand>(commandId));
+
+		uint8 bForceReconcile = signal.bForceReconcile;
+		Ar.SerializeBits(&bForceReconcile, 1);
+		signal.bForceReconcile = bForceReconcile != 0;
+
+		// Clear sentinel carries INT32_MAX, which would not pack well
+		uint8 bClearSentinel = signal.RequiredContextVersion == INT32_MAX;
+		Ar.SerializeBits(&bClearSentinel, 1);
+		if (bClearSentinel)
+		{
+			signal.RequiredContextVersion = INT32_MAX;
+			continue;
+		}
+
+		uint32 packedVersion = static_cast<uint32>(FMath::Max(signal.RequiredContextVersion, 0));
+		Ar.SerializeIntPacked(packedVersion);
+		signal.RequiredContextVersion = static_cast<int32>(packedVersion);
+	}
+
+	return true;
+}
@@ -7,7 +7,6 @@
 #include "Graph/MounteaDialogueGraph.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueParticipantStatics.h"
-#include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
@@ -103,13 +102,15 @@ bool UMounteaDialogueDecorator_OnlyFirstTime::IsFirstTime() const
 	if (!ParticipantInterface.GetObject())
 		ParticipantInterface = UMounteaDialogueParticipantStatics::GetGraphOwnerParticipant(Context->DialogueParticipants);
 	
+	const FGuid nodeGuid = GetOwningNode()->GetNodeGUID();
+	const FGuid graphGuid = GetOwningNode()->GetGraphGUID();
+
 	if (ParticipantInterface.GetObject() && ParticipantInterface.GetInterface())
 	{
-		const TArray<FDialogueTraversePath> traversedPath = UMounteaDialogueParticipantStatics::GetTraversedPath(ParticipantInterface);
-		if (UMounteaDialogueTraversalStatics::HasNodeBeenTraversed(GetOwningNode(), traversedPath)) return false;
+		if (ParticipantInterface->GetNodeTraverseCount(nodeGuid, graphGuid) > 0) return false;
 	}
 
-	if (UMounteaDialogueTraversalStatics::HasNodeBeenTraversed(GetOwningNode(), Context->GetTraversedPath())) return false;
+	if (Context->GetConditionTraverseCount(nodeGuid, graphGuid) > 0) return false;
 
 	return true;
 }
@@ -76,14 +76,14 @@ void UMounteaDialogueDecorator_OverrideDialogue::ExecuteDecorator_Implementation
 		// We assume Context and Manager are already valid, but safety is safety
 		if (!UMounteaDialogueContextStatics::IsContextValid(TempContext)) return;
 
-		const FDialogueRow NewRow = UMounteaDialogueTraversalStatics::GetDialogueRow(DataTable, RowName);
+		const TSharedRef<const FDialogueRow> NewRow = UMounteaDialogueTraversalStatics::GetDialogueRowShared(DataTable, RowName);
 
 		FDataTableRowHandle newDialogueTableHandle = FDataTableRowHandle();
 		newDialogueTableHandle.DataTable = DataTable;
 		newDialogueTableHandle.RowName = RowName;
 		
 		TempContext->UpdateActiveDialogueTable(newDialogueTableHandle);
-		TempContext->UpdateActiveDialogueRow(NewRow);
+		TempContext->UpdateActiveDialogueRow(*NewRow);
 	}
 }
 
@@ -45,14 +45,14 @@ void UMounteaDialogueDecorator_OverrideOnlyFirstTime::ExecuteDecorator_Implement
 		if (!UMounteaDialogueContextStatics::IsContextValid(TempContext)) return;
 		if (!IsFirstTime()) return;
 
-		const FDialogueRow NewRow = UMounteaDialogueTraversalStatics::GetDialogueRow(DataTable, RowName);
+		const TSharedRef<const FDialogueRow> NewRow = UMounteaDialogueTraversalStatics::GetDialogueRowShared(DataTable, RowName);
 
 		FDataTableRowHandle newDialogueTableHandle = FDataTableRowHandle();
 		newDialogueTableHandle.DataTable = DataTable;
 		newDialogueTableHandle.RowName = RowName;
 		
 		TempContext->UpdateActiveDialogueTable(newDialogueTableHandle);
-		TempContext->UpdateActiveDialogueRow(NewRow);
+		TempContext->UpdateActiveDialogueRow(*NewRow);
 	}
 }
 
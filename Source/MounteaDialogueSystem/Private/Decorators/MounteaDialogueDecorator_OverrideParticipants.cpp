@@ -3,6 +3,7 @@
 
 #include "Decorators/MounteaDialogueDecorator_OverrideParticipants.h"
 
+#include "Components/MounteaDialogueManager.h"
 #include "Components/MounteaDialogueSession.h"
 #include "Helpers/MounteaDialogueContextStatics.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
@@ -85,7 +86,7 @@ void UMounteaDialogueDecorator_OverrideParticipants::ExecuteDecorator_Implementa
 	if (UWorld* world = OwningManager.GetObject() ? OwningManager.GetObject()->GetWorld() : nullptr)
 	{
 		if (UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>())
-			session = subsystem->GetGameStateSession();
+			session = subsystem->FindSessionForManager(Cast<UMounteaDialogueManager>(OwningManager.GetObject()));
 	}
 	
 	if (bOverridePlayerParticipant)
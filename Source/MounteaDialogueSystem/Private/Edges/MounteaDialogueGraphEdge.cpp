@@ -3,6 +3,8 @@
 
 #include "Edges/MounteaDialogueGraphEdge.h"
 
+#include "Graph/MounteaDialogueGraph.h"
+
 UMounteaDialogueGraphEdge::UMounteaDialogueGraphEdge()
 {
 }
@@ -16,3 +18,16 @@ FMounteaDialogueEdgeConditions UMounteaDialogueGraphEdge::GetEdgeConditions() co
 {
 	return EdgeConditions;
 }
+
+#if WITH_EDITOR
+
+void UMounteaDialogueGraphEdge::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Compiled Graph references the rules by index
+	if (Graph)
+		Graph->InvalidateCompiledGraph();
+}
+
+#endif
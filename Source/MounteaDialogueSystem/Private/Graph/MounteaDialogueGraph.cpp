@@ -8,9 +8,11 @@
 #include "Helpers/MounteaMonologueStatics.h"
 #include "Misc/DataValidation.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_OpenChildGraph.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
 #include "Settings/MounteaDialogueConfiguration.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
+#include "UObject/ObjectSaveContext.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraph"
 
@@ -41,17 +43,99 @@ void UMounteaDialogueGraph::SetGraphGUID(const FGuid& NewGuid)
 
 UMounteaDialogueGraphNode* UMounteaDialogueGraph::FindNodeByGuid(const FGuid& NodeGuid)
 {
-	TArray<UMounteaDialogueGraphNode*> allDialogueNodes = AllNodes;
-	allDialogueNodes.AddUnique(StartNode);
-	for (UMounteaDialogueGraphNode* Node : allDialogueNodes)
+	return GetNodeByGuid(NodeGuid);
+}
+
+UMounteaDialogueGraphNode* UMounteaDialogueGraph::GetNodeByGuid(const FGuid& NodeGuid) const
+{
+	const int32 nodeIndex = FindNodeIndexByGuid(NodeGuid);
+	if (nodeIndex != INDEX_NONE)
+		return AllNodes[nodeIndex];
+
+	// Start Node is expected to live in AllNodes, but older assets might not have it registered there
+	if (StartNode && StartNode->GetNodeGUID() == NodeGuid)
+		return StartNode;
+
+	return nullptr;
+}
+
+int32 UMounteaDialogueGraph::FindNodeIndexByGuid(const FGuid& NodeGuid) const
+{
+	if (!NodeGuid.IsValid())
+		return INDEX_NONE;
+
+	// Guard only, a stale index misses instead of returning a different Node
+	const int32* nodeIndex = NodeIndexByGuid.Find(NodeGuid);
+	if (nodeIndex && AllNodes.IsValidIndex(*nodeIndex) && AllNodes[*nodeIndex] && AllNodes[*nodeIndex]->GetNodeGUID() == NodeGuid)
+		return *nodeIndex;
+
+	return INDEX_NONE;
+}
+
+void UMounteaDialogueGraph::RebuildNodeIndex()
+{
+	NodeIndexByGuid.Reset();
+	NodeIndexByGuid.Reserve(AllNodes.Num());
+
+	for (int32 i = 0; i < AllNodes.Num(); ++i)
 	{
-		if (Node && Node->GetNodeGUID() == NodeGuid)
-			return Node;
+		const UMounteaDialogueGraphNode* node = AllNodes[i];
+		if (!node || !node->GetNodeGUID().IsValid())
+			continue;
+
+		// First occurrence wins, same as the linear search did
+		if (!NodeIndexByGuid.Contains(node->GetNodeGUID()))
+			NodeIndexByGuid.Add(node->GetNodeGUID(), i);
 	}
+}
 
-	return nullptr;
+int32 UMounteaDialogueGraph::FindStableNodeIndex(const FGuid& NodeGuid) const
+{
+	const int32* stableIndex = StableNodeIndexByGuid.Find(NodeGuid);
+	return stableIndex ? *stableIndex : INDEX_NONE;
+}
+
+void UMounteaDialogueGraph::RegisterStableNodeIndices()
+{
+	if (StableNodeIndexByGuid.Num() != StableNodeGuids.Num())
+	{
+		StableNodeIndexByGuid.Reset();
+		StableNodeIndexByGuid.Reserve(StableNodeGuids.Num());
+		for (int32 i = 0; i < StableNodeGuids.Num(); ++i)
+			StableNodeIndexByGuid.Add(StableNodeGuids[i], i);
+	}
+
+	// AllNodes order keeps assignment deterministic for assets saved before stable indices existed
+	for (const UMounteaDialogueGraphNode* node : AllNodes)
+	{
+		if (!node || !node->GetNodeGUID().IsValid() || StableNodeIndexByGuid.Contains(node->GetNodeGUID()))
+			continue;
+
+		StableNodeIndexByGuid.Add(node->GetNodeGUID(), StableNodeGuids.Add(node->GetNodeGUID()));
+	}
+}
+
+void UMounteaDialogueGraph::CompileGraph()
+{
+#if WITH_EDITOR
+	// Editor operations only maintain the Edges map, ChildEdges must follow the current ChildrenNodes order
+	RebuildChildEdges();
+#endif
+
+	RebuildNodeIndex();
+	RegisterStableNodeIndices();
+	CompiledGraph.Compile(*this);
+}
+
+#if WITH_EDITOR
+
+void UMounteaDialogueGraph::RecompileConditionOps()
+{
+	CompiledGraph.CompileConditionOps(*this);
 }
 
+#endif
+
 TArray<UMounteaDialogueGraphNode*> UMounteaDialogueGraph::GetAllNodes() const
 {
 	return AllNodes;
@@ -69,24 +153,18 @@ UMounteaDialogueGraphNode* UMounteaDialogueGraph::GetStartNode() const
 
 TArray<FMounteaDialogueDecorator> UMounteaDialogueGraph::GetGraphDecorators() const
 {
-	TArray<FMounteaDialogueDecorator> TempReturn;
-	TArray<FMounteaDialogueDecorator> Return;
-
-	for (auto Itr : GraphDecorators)
-	{
-		if (Itr.DecoratorType != nullptr)
-			TempReturn.AddUnique(Itr);
-	}
+	FMounteaDialogueDecoratorBuffer graphDecorators;
+	AppendGraphDecorators(graphDecorators);
+	return TArray<FMounteaDialogueDecorator>(graphDecorators);
+}
 
-	/* TODO: Cleanup duplicates
-	for (auto Itr : TempReturn)
+void UMounteaDialogueGraph::AppendGraphDecorators(FMounteaDialogueDecoratorBuffer& OutDecorators) const
+{
+	for (const FMounteaDialogueDecorator& decorator : GraphDecorators)
 	{
-		
+		if (decorator.DecoratorType != nullptr)
+			OutDecorators.AddUnique(decorator);
 	}
-	*/
-
-	Return = TempReturn;
-	return Return;
 }
 
 TArray<FMounteaDialogueDecorator> UMounteaDialogueGraph::GetGraphScopeDecorators() const
@@ -208,6 +286,8 @@ void UMounteaDialogueGraph::CreateGraph()
 		RootNodes.Add(StartNode);
 		AllNodes.Add(StartNode);
 	}
+
+	CompileGraph();
 #endif
 }
 
@@ -219,11 +299,15 @@ void UMounteaDialogueGraph::ClearGraph()
 
 		Node->ParentNodes.Empty();
 		Node->ChildrenNodes.Empty();
+		Node->ChildEdges.Empty();
 		Node->Edges.Empty();
 	}
 
 	AllNodes.Empty();
 	RootNodes.Empty();
+
+	RebuildNodeIndex();
+	CompiledGraph.Reset();
 }
 
 void UMounteaDialogueGraph::PostInitProperties()
@@ -241,6 +325,55 @@ void UMounteaDialogueGraph::PostInitProperties()
 #endif
 }
 
+void UMounteaDialogueGraph::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildNodeIndex();
+
+	// Assets saved before stable indices existed get them in AllNodes order, only in memory until resaved
+	const bool bStableNodeIndicesUnsaved = StableNodeGuids.IsEmpty() && !AllNodes.IsEmpty();
+	RegisterStableNodeIndices();
+
+#if WITH_EDITOR
+	// ❗ Indices must be persisted before the first Node removal, otherwise later loads would assign them differently.
+	// Loading never dirties the asset, PreSave persists them once it is saved or resaved by the ResavePackages commandlet.
+	if (bStableNodeIndicesUnsaved && !HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		LOG_INFO(TEXT("[Stable Node Indices] Graph '%s' was saved before stable Node indices existed, resave it to persist them."), *GetName())
+	}
+
+	// Older assets only store the Edges map, migrate them to the index aligned ChildEdges
+	RebuildChildEdges();
+
+	// Nodes might have been edited without the Graph being resaved
+	if (CompiledGraph.IsUpToDate(*this))
+		CompiledGraph.CompileConditionOps(*this);
+	else
+		CompileGraph();
+#else
+	// Cooked columns are compiled in PreSave and trusted as is, only condition ops are not serialized
+	if (CompiledGraph.Num() == AllNodes.Num())
+		CompiledGraph.CompileConditionOps(*this);
+	else
+	{
+		LOG_WARNING(TEXT("[Compiled Graph] Graph '%s' was cooked without compiled data, compiling on load."), *GetName())
+		CompileGraph();
+	}
+#endif
+}
+
+void UMounteaDialogueGraph::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	CompileGraph();
+
+#if WITH_EDITOR
+	GatherChildGraphDependencies();
+#endif
+}
+
 void UMounteaDialogueGraph::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
 	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
@@ -600,6 +733,51 @@ EDataValidationResult UMounteaDialogueGraph::IsDataValid(FDataValidationContext&
 	return EDataValidationResult::Invalid;
 }
 
+void UMounteaDialogueGraph::RebuildChildEdges()
+{
+	for (UMounteaDialogueGraphNode* node : AllNodes)
+	{
+		if (node)
+			node->RebuildChildEdges();
+	}
+}
+
+void UMounteaDialogueGraph::GatherChildGraphDependencies()
+{
+	ChildGraphDependencies.Reset();
+
+	TArray<const UMounteaDialogueGraph*> graphsToVisit;
+	TSet<const UMounteaDialogueGraph*> visitedGraphs;
+	graphsToVisit.Add(this);
+
+	while (graphsToVisit.Num() > 0)
+	{
+		const UMounteaDialogueGraph* currentGraph = graphsToVisit.Pop(EAllowShrinking::No);
+		if (!IsValid(currentGraph) || visitedGraphs.Contains(currentGraph))
+			continue;
+
+		visitedGraphs.Add(currentGraph);
+
+		for (const UMounteaDialogueGraphNode* node : currentGraph->AllNodes)
+		{
+			const UMounteaDialogueGraphNode_OpenChildGraph* openChildNode = Cast<UMounteaDialogueGraphNode_OpenChildGraph>(node);
+			if (!openChildNode || openChildNode->TargetDialogue.IsNull())
+				continue;
+
+			const FSoftObjectPath childGraphPath = openChildNode->TargetDialogue.ToSoftObjectPath();
+			if (childGraphPath == FSoftObjectPath(this))
+				continue;
+
+			ChildGraphDependencies.AddUnique(childGraphPath);
+
+			// Editor only, loading here keeps runtime from ever doing it
+			const UMounteaDialogueGraph* childGraph = openChildNode->TargetDialogue.LoadSynchronous();
+			if (IsValid(childGraph) && !visitedGraphs.Contains(childGraph))
+				graphsToVisit.Add(childGraph);
+		}
+	}
+}
+
 UMounteaDialogueGraphNode* UMounteaDialogueGraph::ConstructDialogueNode(
 	TSubclassOf<UMounteaDialogueGraphNode> NodeClass)
 {
@@ -12,14 +12,52 @@
 
 #include "Helpers/MounteaDialogueConditionsStatics.h"
 
+#include "Algo/StableSort.h"
 #include "Conditions/MounteaDialogueConditionBase.h"
+#include "Data/MounteaDialogueConditionCache.h"
+#include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueSessionStats.h"
 #include "Edges/MounteaDialogueGraphEdge.h"
 #include "Helpers/MounteaDialogueSystemConsts.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
+namespace MounteaDialogueConditionsStatics_Private
+{
+	// Null if the Context does not cache condition results, Blueprint Contexts never do.
+	FMounteaDialogueConditionCache* GetConditionCache(const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context, FMounteaDialogueConditionRevision& OutRevision)
+	{
+		IMounteaDialogueConditionContextInterface* contextInterface = Context.GetInterface();
+		return contextInterface ? contextInterface->GetConditionCache(OutRevision) : nullptr;
+	}
+
+	bool EvaluateCondition(UMounteaDialogueConditionBase* Condition, const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context,
+		FMounteaDialogueConditionCache* Cache, const FMounteaDialogueConditionRevision& Revision, const bool bNative = false)
+	{
+		const EMounteaDialogueConditionCaching caching = Condition->Caching;
+		if (Cache && caching != EMounteaDialogueConditionCaching::Never)
+		{
+			if (const bool* cachedResult = Cache->Find(Condition, caching, Revision))
+				return *cachedResult;
+		}
+
+		MOUNTEA_DIALOGUE_SESSION_STATS_CONDITION();
+		const bool bResult = bNative ? Condition->EvaluateCondition_Implementation(Context) : Condition->EvaluateCondition(Context);
+		if (Cache && caching != EMounteaDialogueConditionCaching::Never)
+			Cache->Add(Condition, caching, bResult);
+
+		return bResult;
+	}
+}
 
 bool UMounteaDialogueConditionsStatics::EvaluateCondition(UMounteaDialogueConditionBase* Condition, const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context)
 {
-	return IsValid(Condition) ? Condition->EvaluateCondition(Context) : false;
+	if (!IsValid(Condition))
+		return false;
+
+	FMounteaDialogueConditionRevision revision;
+	FMounteaDialogueConditionCache* cache = MounteaDialogueConditionsStatics_Private::GetConditionCache(Context, revision);
+	return MounteaDialogueConditionsStatics_Private::EvaluateCondition(Condition, Context, cache, revision);
 }
 
 FString UMounteaDialogueConditionsStatics::GetConditionName(UMounteaDialogueConditionBase* Condition)
@@ -37,17 +75,26 @@ bool UMounteaDialogueConditionsStatics::EvaluateEdgeConditions(const UMounteaDia
 	if (!IsValid(Edge))
 		return true;
 
-	const FMounteaDialogueEdgeConditions& conds = Edge->GetEdgeConditions();
-	if (conds.Rules.IsEmpty())
+	const FMounteaDialogueEdgeConditions& conds = Edge->EdgeConditions;
+	return EvaluateConditionRules(conds.Rules, conds.Mode, Context);
+}
+
+bool UMounteaDialogueConditionsStatics::EvaluateConditionRules(TConstArrayView<FMounteaDialogueCondition> Rules, const EConditionEvaluationMode Mode, const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context)
+{
+	if (Rules.IsEmpty())
 		return true;
 
-	const bool bAll = (conds.Mode == EConditionEvaluationMode::All);
-	for (const FMounteaDialogueCondition& rule : conds.Rules)
+	// Revision is read once, conditions must not change their Context
+	FMounteaDialogueConditionRevision revision;
+	FMounteaDialogueConditionCache* cache = MounteaDialogueConditionsStatics_Private::GetConditionCache(Context, revision);
+
+	const bool bAll = (Mode == EConditionEvaluationMode::All);
+	for (const FMounteaDialogueCondition& rule : Rules)
 	{
 		if (!IsValid(rule.ConditionClass))
 			continue;
 
-		bool bResult = rule.ConditionClass->EvaluateCondition(Context);
+		bool bResult = MounteaDialogueConditionsStatics_Private::EvaluateCondition(rule.ConditionClass, Context, cache, revision);
 		if (rule.bNegate)
 			bResult = !bResult;
 
@@ -60,3 +107,158 @@ bool UMounteaDialogueConditionsStatics::EvaluateEdgeConditions(const UMounteaDia
 
 	return bAll;
 }
+
+void UMounteaDialogueConditionsStatics::CompileConditionRules(TConstArrayView<FMounteaDialogueCondition> Rules, TArray<FMounteaDialogueConditionOp>& OutOps)
+{
+	const int32 firstOp = OutOps.Num();
+	bool bCanReorder = true;
+	for (const FMounteaDialogueCondition& rule : Rules)
+	{
+		FMounteaDialogueConditionOp& op = OutOps.AddDefaulted_GetRef();
+		op.Condition = rule.ConditionClass;
+		op.bNegate = rule.bNegate;
+		op.bNative = IsValid(rule.ConditionClass) && rule.ConditionClass->HasNativeEvaluation();
+
+		// Skipped or delayed Blueprint condition must not change anything, only Pure ones promise that
+		if (!op.bNative && IsValid(rule.ConditionClass) && rule.ConditionClass->Caching != EMounteaDialogueConditionCaching::Pure)
+			bCanReorder = false;
+	}
+
+	if (!bCanReorder)
+		return;
+
+	// All and Any do not depend on order, Blueprint conditions go last so short-circuit skips them most often
+	Algo::StableSortBy(MakeArrayView(OutOps.GetData() + firstOp, OutOps.Num() - firstOp),
+		[](const FMounteaDialogueConditionOp& Op) { return Op.bNative ? 0 : 1; });
+}
+
+bool UMounteaDialogueConditionsStatics::EvaluateConditionOps(TConstArrayView<FMounteaDialogueConditionOp> Ops, const EConditionEvaluationMode Mode, const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context)
+{
+	if (Ops.IsEmpty())
+		return true;
+
+	FMounteaDialogueConditionRevision revision;
+	FMounteaDialogueConditionCache* cache = MounteaDialogueConditionsStatics_Private::GetConditionCache(Context, revision);
+
+	// All exits on the first failing step, Any on the first passing one
+	const bool bExitResult = (Mode != EConditionEvaluationMode::All);
+	for (const FMounteaDialogueConditionOp& op : Ops)
+	{
+		if (!IsValid(op.Condition))
+			continue;
+
+		const bool bResult = MounteaDialogueConditionsStatics_Private::EvaluateCondition(op.Condition, Context, cache, revision, op.bNative) != op.bNegate;
+		if (bResult == bExitResult)
+			return bExitResult;
+	}
+
+	return !bExitResult;
+}
+
+#if !UE_BUILD_SHIPPING
+
+static void RunConditionBenchmark(const int32 SetCount, const int32 RulesPerSet, const int32 Iterations, const FString& BlueprintClassPath)
+{
+	// Blueprint conditions overriding EvaluateCondition go through the Blueprint VM, those are what native first ordering skips
+	TArray<UClass*> blueprintClasses;
+	if (!BlueprintClassPath.IsEmpty())
+	{
+		UClass* blueprintClass = LoadObject<UClass>(nullptr, *BlueprintClassPath);
+		if (!blueprintClass || !blueprintClass->IsChildOf<UMounteaDialogueConditionBase>())
+			LOG_WARNING(TEXT("[Condition Benchmark] '%s' is not a Dialogue Condition class."), *BlueprintClassPath)
+		else
+			blueprintClasses.Add(blueprintClass);
+	}
+
+	for (TObjectIterator<UClass> classIt; classIt; ++classIt)
+	{
+		UClass* conditionClass = *classIt;
+		if (!conditionClass->IsChildOf<UMounteaDialogueConditionBase>() || conditionClass->HasAnyClassFlags(CLASS_Native | CLASS_Abstract | CLASS_NewerVersionExists))
+			continue;
+
+		if (!conditionClass->GetDefaultObject<UMounteaDialogueConditionBase>()->HasNativeEvaluation())
+			blueprintClasses.AddUnique(conditionClass);
+	}
+
+	if (blueprintClasses.IsEmpty())
+		LOG_WARNING(TEXT("[Condition Benchmark] No loaded Blueprint condition overrides EvaluateCondition, sets only contain native conditions. Pass a Blueprint condition class path to cover the Blueprint path."))
+
+	// Synthetic sets mixing native and Blueprint conditions, negation and mode are random so both short-circuit paths are taken
+	FRandomStream random(1337);
+	int32 blueprintConditionCount = 0;
+	TArray<TObjectPtr<UMounteaDialogueConditionBase>> conditions;
+	TArray<TArray<FMounteaDialogueCondition>> ruleSets;
+	TArray<TArray<FMounteaDialogueConditionOp>> opSets;
+	TArray<EConditionEvaluationMode> modes;
+	ruleSets.SetNum(SetCount);
+	opSets.SetNum(SetCount);
+	modes.SetNum(SetCount);
+
+	for (int32 setIndex = 0; setIndex < SetCount; ++setIndex)
+	{
+		modes[setIndex] = random.RandRange(0, 1) ? EConditionEvaluationMode::All : EConditionEvaluationMode::Any;
+		for (int32 ruleIndex = 0; ruleIndex < RulesPerSet; ++ruleIndex)
+		{
+			FMounteaDialogueCondition& rule = ruleSets[setIndex].AddDefaulted_GetRef();
+			UClass* conditionClass = UMounteaDialogueConditionBase::StaticClass();
+			if (!blueprintClasses.IsEmpty() && random.FRand() < 0.5f)
+			{
+				conditionClass = blueprintClasses[random.RandHelper(blueprintClasses.Num())];
+				blueprintConditionCount++;
+			}
+
+			rule.ConditionClass = conditions.Add_GetRef(NewObject<UMounteaDialogueConditionBase>(GetTransientPackage(), conditionClass));
+			rule.bNegate = random.FRand() < 0.25f;
+		}
+		UMounteaDialogueConditionsStatics::CompileConditionRules(ruleSets[setIndex], opSets[setIndex]);
+	}
+
+	const TScriptInterface<IMounteaDialogueConditionContextInterface> context(NewObject<UMounteaDialogueContext>(GetTransientPackage()));
+
+	int32 interpretedPassed = 0;
+	const uint64 interpretedStart = FPlatformTime::Cycles64();
+	for (int32 iteration = 0; iteration < Iterations; ++iteration)
+	{
+		for (int32 setIndex = 0; setIndex < SetCount; ++setIndex)
+			interpretedPassed += UMounteaDialogueConditionsStatics::EvaluateConditionRules(ruleSets[setIndex], modes[setIndex], context) ? 1 : 0;
+	}
+	const double interpretedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - interpretedStart);
+
+	int32 compiledPassed = 0;
+	const uint64 compiledStart = FPlatformTime::Cycles64();
+	for (int32 iteration = 0; iteration < Iterations; ++iteration)
+	{
+		for (int32 setIndex = 0; setIndex < SetCount; ++setIndex)
+			compiledPassed += UMounteaDialogueConditionsStatics::EvaluateConditionOps(opSets[setIndex], modes[setIndex], context) ? 1 : 0;
+	}
+	const double compiledMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - compiledStart);
+
+	const int32 evaluationCount = SetCount * Iterations;
+	LOG_INFO(TEXT("[Condition Benchmark] %d sets x %d rules (%d Blueprint conditions of %d classes) x %d iterations. Interpreted %.3f ms (%.1f ns/set), compiled %.3f ms (%.1f ns/set), speedup %.2fx."),
+		SetCount, RulesPerSet, blueprintConditionCount, blueprintClasses.Num(), Iterations,
+		interpretedMs, interpretedMs * 1000000.0 / evaluationCount,
+		compiledMs, compiledMs * 1000000.0 / evaluationCount,
+		compiledMs > 0.0 ? interpretedMs / compiledMs : 0.0)
+
+	if (interpretedPassed != compiledPassed)
+		LOG_ERROR(TEXT("[Condition Benchmark] Results differ, interpreted passed %d sets, compiled %d."), interpretedPassed, compiledPassed)
+}
+
+static FAutoConsoleCommand GMounteaDialogueConditionBenchmarkCommand(
+	TEXT("Mountea.Dialogue.ConditionBenchmark"),
+	TEXT("Compares interpreted and compiled evaluation of synthetic condition sets, half of the conditions are Blueprint ones if any is loaded. Usage: Mountea.Dialogue.ConditionBenchmark [Sets=1024] [RulesPerSet=4] [Iterations=100] [BlueprintConditionClass]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		const int32 setCount = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1024;
+		const int32 rulesPerSet = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4;
+		const int32 iterations = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 100;
+		if (setCount <= 0 || rulesPerSet <= 0 || iterations <= 0 || setCount * rulesPerSet > 1 << 20)
+		{
+			LOG_WARNING(TEXT("[Condition Benchmark] Sets, rules per set and iterations must be positive, at most 1M conditions."))
+			return;
+		}
+
+		RunConditionBenchmark(setCount, rulesPerSet, iterations, Args.Num() > 3 ? Args[3] : FString());
+	}));
+
+#endif
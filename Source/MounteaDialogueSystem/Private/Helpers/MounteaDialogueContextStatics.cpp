@@ -25,19 +25,17 @@ UMounteaDialogueGraphNode* UMounteaDialogueContextStatics::FindNodeByGUID(const
 	if (!IsValid(FromGraph) || !ByGUID.IsValid())
 		return nullptr;
 
-	const TArray<UMounteaDialogueGraphNode*> allNodes = FromGraph->GetAllNodes();
-	for (UMounteaDialogueGraphNode* node : allNodes)
-	{
-		if (IsValid(node) && node->GetNodeGUID() == ByGUID)
-			return node;
-	}
-
-	return nullptr;
+	UMounteaDialogueGraphNode* node = FromGraph->GetNodeByGuid(ByGUID);
+	return IsValid(node) ? node : nullptr;
 }
 
 TArray<UMounteaDialogueGraphNode*> UMounteaDialogueContextStatics::FindNodesByGUID(const UMounteaDialogueGraph* FromGraph, const TArray<FGuid>& Guids)
 {
 	TArray<UMounteaDialogueGraphNode*> result;
+	if (!IsValid(FromGraph))
+		return result;
+
+	result.Reserve(Guids.Num());
 	for (const FGuid& guid : Guids)
 	{
 		if (UMounteaDialogueGraphNode* node = FindNodeByGUID(FromGraph, guid))
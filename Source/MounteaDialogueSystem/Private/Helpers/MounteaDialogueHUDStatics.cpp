@@ -40,7 +40,7 @@ FGuid UMounteaDialogueHUDStatics::GetDialogueNodeGuid(UMounteaDialogueGraphNode*
 FDialogueRow UMounteaDialogueHUDStatics::GetDialogueNodeRow(UMounteaDialogueGraphNode* FromNode)
 {
 	if (IsValid(FromNode) && FromNode->Implements<UMounteaDialogueSpeechDataInterface>())
-		return UMounteaDialogueTraversalStatics::GetSpeechData(FromNode);
+		return *UMounteaDialogueTraversalStatics::GetSpeechDataShared(FromNode);
 
 	return FDialogueRow::Invalid();
 }
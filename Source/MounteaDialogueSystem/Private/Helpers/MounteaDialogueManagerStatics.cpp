@@ -9,7 +9,7 @@
 #include "Engine/World.h"
 #include "Graph/MounteaDialogueGraph.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
-#include "Nodes/MounteaDialogueGraphNode_OpenChildGraph.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
 
 UMounteaDialogueGraph* UMounteaDialogueManagerStatics::ResolveGraphByGuid(
 	const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& Participants,
@@ -18,44 +18,38 @@ UMounteaDialogueGraph* UMounteaDialogueManagerStatics::ResolveGraphByGuid(
 	if (!GraphGuid.IsValid())
 		return nullptr;
 
-	TArray<UMounteaDialogueGraph*> graphsToVisit;
-	TSet<const UMounteaDialogueGraph*> visitedGraphs;
+	UMounteaDialogueGraphRegistrySubsystem* graphRegistry = nullptr;
+	for (const auto& participant : Participants)
+	{
+		graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(participant.GetObject());
+		if (graphRegistry)
+			break;
+	}
 
+	if (!graphRegistry)
+		return nullptr;
+
+	if (UMounteaDialogueGraph* registeredGraph = graphRegistry->FindGraph(GraphGuid))
+		return registeredGraph;
+
+	// First payload for these participants, register their Graphs (and resident child Graphs) once
 	for (const auto& participant : Participants)
 	{
 		if (!participant.GetObject() || !participant.GetInterface())
 			continue;
 
-		UMounteaDialogueGraph* participantGraph = participant->Execute_GetDialogueGraph(participant.GetObject());
-		if (IsValid(participantGraph))
-			graphsToVisit.AddUnique(participantGraph);
+		graphRegistry->RegisterGraph(participant->Execute_GetDialogueGraph(participant.GetObject()));
 	}
 
-	while (graphsToVisit.Num() > 0)
+	UMounteaDialogueGraph* resolvedGraph = graphRegistry->FindGraph(GraphGuid);
+	if (!resolvedGraph && graphRegistry->GetGraphLoadState(GraphGuid) == EMounteaDialogueGraphLoadState::NotLoaded)
 	{
-		UMounteaDialogueGraph* currentGraph = graphsToVisit.Pop(EAllowShrinking::No);
-		if (!IsValid(currentGraph) || visitedGraphs.Contains(currentGraph))
-			continue;
-
-		visitedGraphs.Add(currentGraph);
-
-		if (currentGraph->GetGraphGUID() == GraphGuid)
-			return currentGraph;
-
-		const TArray<UMounteaDialogueGraphNode*> allNodes = currentGraph->GetAllNodes();
-		for (const auto* node : allNodes)
-		{
-			const auto* openChildNode = Cast<UMounteaDialogueGraphNode_OpenChildGraph>(node);
-			if (!IsValid(openChildNode))
-				continue;
-
-			UMounteaDialogueGraph* childGraph = openChildNode->TargetDialogue.LoadSynchronous();
-			if (IsValid(childGraph) && !visitedGraphs.Contains(childGraph))
-				graphsToVisit.AddUnique(childGraph);
-		}
+		// Never load synchronously here, Session holds the payload back until the load finishes
+		LOG_WARNING(TEXT("[Resolve Graph By Guid] Graph '%s' is not loaded yet, requesting async load."), *GraphGuid.ToString())
+		graphRegistry->RequestGraphLoad(GraphGuid);
 	}
 
-	return nullptr;
+	return resolvedGraph;
 }
 
 TScriptInterface<IMounteaDialogueManagerInterface> UMounteaDialogueManagerStatics::FindDialogueManagerInterface(UObject* ManagerActor, bool& bResult)
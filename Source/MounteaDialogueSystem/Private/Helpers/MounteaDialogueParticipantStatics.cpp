@@ -3,6 +3,7 @@
 
 #include "Helpers/MounteaDialogueParticipantStatics.h"
 
+#include "Components/MounteaDialogueManager.h"
 #include "Components/MounteaDialogueSession.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/Pawn.h"
@@ -239,7 +240,12 @@ TScriptInterface<IMounteaDialogueParticipantInterface> UMounteaDialogueParticipa
 	{
 		if (UMounteaDialogueWorldSubsystem* dialogueSubsystem = participantWorld->GetSubsystem<UMounteaDialogueWorldSubsystem>())
 		{
-			if (UMounteaDialogueSession* dialogueSession = dialogueSubsystem->GetGameStateSession())
+			// Role overrides live on the Session of the requesting manager, or of the participants
+			UMounteaDialogueSession* dialogueSession = dialogueSubsystem->FindSessionForManager(Cast<UMounteaDialogueManager>(WorldContextObject));
+			for (int32 i = 0; !dialogueSession && i < Participants.Num(); ++i)
+				dialogueSession = dialogueSubsystem->FindSessionForParticipant(Participants[i].GetObject());
+
+			if (dialogueSession)
 			{
 				const TScriptInterface<IMounteaDialogueParticipantInterface> sessionOverride = dialogueSession->GetRoleOverride(Type);
 				if (sessionOverride.GetObject() && sessionOverride.GetInterface())
@@ -9,6 +9,7 @@
 #include "Edges/MounteaDialogueGraphEdge.h"
 #include "Graph/MounteaDialogueGraph.h"
 #include "Helpers/MounteaDialogueConditionsStatics.h"
+#include "Helpers/MounteaDialogueTraversalStatics.h"
 
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
@@ -49,6 +50,9 @@ bool UMounteaDialogueSystemBFC::HasNodeBeenTraversed(const UMounteaDialogueGraph
 	if (!Node || !Participant || !Participant.GetObject() || !Node->Graph)
 		return false;
 
+	if (Participant.GetInterface())
+		return Participant->GetNodeTraverseCount(Node->GetNodeGUID(), Node->Graph->GetGraphGUID()) > 0;
+
 	const TArray<FDialogueTraversePath>& TraversedPaths = Participant->Execute_GetTraversedPath(Participant.GetObject());
 	const FDialogueTraversePath* FoundPath = TraversedPaths.FindByPredicate([&](const FDialogueTraversePath& Path)
 	{
@@ -63,14 +67,7 @@ bool UMounteaDialogueSystemBFC::HasNodeBeenTraversedV2(const UMounteaDialogueGra
 	if (!Node || !Context || !Node->Graph)
 		return false;
 	
-	const TArray<FDialogueTraversePath>& TraversedPaths = Context->TraversedPath;
-
-	const FDialogueTraversePath* FoundPath = TraversedPaths.FindByPredicate([&](const FDialogueTraversePath& Path)
-	{
-		return Path.NodeGuid == Node->GetNodeGUID() && Path.GraphGuid == Node->Graph->GetGraphGUID();
-	});
-
-	return FoundPath != nullptr;
+	return Context->GetConditionTraverseCount(Node->GetNodeGUID(), Node->Graph->GetGraphGUID()) > 0;
 }
 
 UAudioComponent* UMounteaDialogueSystemBFC::FindAudioComponentByName(const AActor* ActorContext, const FName& Arg)
@@ -239,7 +236,8 @@ TScriptInterface<IMounteaDialogueParticipantInterface> UMounteaDialogueSystemBFC
 
 	if (IsValid(Context->ActiveNode) && NodeHasSpeechData(Context->ActiveNode))
 	{
-		const FDialogueRow Row = GetSpeechData(Context->ActiveNode);
+		const TSharedRef<const FDialogueRow> sharedRow = UMounteaDialogueTraversalStatics::GetSpeechDataShared(Context->ActiveNode);
+		const FDialogueRow& Row = *sharedRow;
 		const auto Predicate = [&Row](const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant)
 		{
 			return Row.CompatibleTags.HasTagExact(Participant->Execute_GetParticipantTag(Participant.GetObject()));
@@ -258,17 +256,13 @@ UMounteaDialogueGraphNode* UMounteaDialogueSystemBFC::FindNodeByGUID(const UMoun
 	if (!FromGraph) return nullptr;
 	if (!ByGUID.IsValid()) return nullptr;
 
-	for (const auto& Itr : FromGraph->GetAllNodes())
-	{
-		if (Itr && Itr->GetNodeGUID() == ByGUID) return Itr;
-	}
-
-	return nullptr;
+	return FromGraph->GetNodeByGuid(ByGUID);
 }
 
 TArray<UMounteaDialogueGraphNode*> UMounteaDialogueSystemBFC::FindNodesByGUID(const UMounteaDialogueGraph* FromGraph, const TArray<FGuid> Guids)
 {
 	TArray<UMounteaDialogueGraphNode*> resultArray;
+	resultArray.Reserve(Guids.Num());
 	for (const auto& Itr : Guids)
 	{
 		if (auto foundNode = FindNodeByGUID(FromGraph, Itr))
@@ -291,8 +285,8 @@ TArray<FGuid> UMounteaDialogueSystemBFC::NodesToGuids(TArray<UMounteaDialogueGra
 
 UMounteaDialogueGraphNode* UMounteaDialogueSystemBFC::GetChildrenNodeFromIndex(const int32 Index, const UMounteaDialogueGraphNode* ParentNode)
 {
-	if (ParentNode->GetChildrenNodes().IsValidIndex(Index))
-		return ParentNode->GetChildrenNodes()[Index];
+	if (ParentNode->GetChildrenNodesView().IsValidIndex(Index))
+		return ParentNode->GetChildrenNodesView()[Index];
 
 	return nullptr;
 }
@@ -301,8 +295,8 @@ UMounteaDialogueGraphNode* UMounteaDialogueSystemBFC::GetFirstChildNode(const UM
 {
 	if (ParentNode == nullptr) return nullptr;
 
-	if (ParentNode->GetChildrenNodes().IsValidIndex(0))
-		return ParentNode->GetChildrenNodes()[0]->CanStartNode() ? ParentNode->GetChildrenNodes()[0] : nullptr;
+	if (ParentNode->GetChildrenNodesView().IsValidIndex(0))
+		return ParentNode->GetChildrenNodesView()[0]->CanStartNode() ? ParentNode->GetChildrenNodesView()[0] : nullptr;
 
 	return nullptr;
 }
@@ -313,9 +307,9 @@ TArray<UMounteaDialogueGraphNode*> UMounteaDialogueSystemBFC::GetAllowedChildNod
 
 	if (!ParentNode) return ReturnNodes;
 
-	if (ParentNode->GetChildrenNodes().Num() == 0) return ReturnNodes;
+	if (ParentNode->GetChildrenNodesView().Num() == 0) return ReturnNodes;
 
-	for (UMounteaDialogueGraphNode* Itr : ParentNode->GetChildrenNodes())
+	for (UMounteaDialogueGraphNode* Itr : ParentNode->GetChildrenNodesView())
 	{
 		if (Itr && Itr->CanStartNode())
 			ReturnNodes.Add(Itr);
@@ -326,24 +320,7 @@ TArray<UMounteaDialogueGraphNode*> UMounteaDialogueSystemBFC::GetAllowedChildNod
 
 TArray<UMounteaDialogueGraphNode*> UMounteaDialogueSystemBFC::GetAllowedChildNodesFiltered(const UMounteaDialogueGraphNode* ParentNode, const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext)
 {
-	TArray<UMounteaDialogueGraphNode*> ReturnNodes;
-
-	if (!ParentNode)
-		return ReturnNodes;
-
-	for (UMounteaDialogueGraphNode* child : ParentNode->GetChildrenNodes())
-	{
-		if (!child || !child->CanStartNode())
-			continue;
-
-		const UMounteaDialogueGraphEdge* const* edgePtr = ParentNode->Edges.Find(child);
-		const UMounteaDialogueGraphEdge* edge = edgePtr ? *edgePtr : nullptr;
-
-		if (UMounteaDialogueConditionsStatics::EvaluateEdgeConditions(edge, ConditionContext))
-			ReturnNodes.Add(child);
-	}
-
-	return ReturnNodes;
+	return UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(ParentNode, ConditionContext);
 }
 
 void UMounteaDialogueSystemBFC::SortNodes(TArray<UMounteaDialogueGraphNode*>& SortedNodes)
@@ -546,6 +523,7 @@ bool UMounteaDialogueSystemBFC::UpdateMatchingDialogueParticipant(UMounteaDialog
 		return false;
 
 	Context->ActiveDialogueParticipant = NewActiveParticipant;
+	Context->MarkConditionStateChanged();
 	Context->OnDialogueContextUpdated.Broadcast();
 	return true;
 }
@@ -556,7 +534,7 @@ FDialogueRowData UMounteaDialogueSystemBFC::GetActiveDialogueData(const UMountea
 	{ bResult = false; return FDialogueRowData(); }
 
 	const int32 activeIndex = Context->GetActiveDialogueRowDataIndex();
-	const auto Row = Context->GetActiveDialogueRow();
+	const FDialogueRow& Row = Context->GetActiveDialogueRow();
 	bResult = Row.RowData.IsValidIndex(activeIndex);
 
 	if (!bResult)
@@ -680,8 +658,8 @@ FDialogueRow UMounteaDialogueSystemBFC::GetDialogueRow(const UMounteaDialogueGra
 		return FDialogueRow::Invalid();
 	}
 
-	const FDialogueRow* Row = DialogueNodeBase->GetDataTable()->FindRow<FDialogueRow>(DialogueNodeBase->GetRowName(), FString("") );
-	if (!Row)
+	const TSharedPtr<const FDialogueRow> Row = FMounteaDialogueRowCache::FindRow(DialogueNodeBase->GetDataTable(), DialogueNodeBase->GetRowName());
+	if (!Row.IsValid())
 	{
 		LOG_WARNING(TEXT("[GetDialogueRow] Node %s has no Row Data by ID: %s!"), *DialogueNodeBase->GetNodeTitle().ToString(), *DialogueNodeBase->GetRowName().ToString())
 		return FDialogueRow::Invalid();
@@ -700,58 +678,13 @@ FDialogueRow UMounteaDialogueSystemBFC::GetDialogueRow(const UDataTable* SourceT
 	if (!SourceTable)
 		return FDialogueRow::Invalid();
 
-	const FDialogueRow* FoundRow = SourceTable->FindRow<FDialogueRow>(SourceName, TEXT(""));
-	return FoundRow ? *FoundRow : FDialogueRow::Invalid();
+	const TSharedPtr<const FDialogueRow> FoundRow = FMounteaDialogueRowCache::FindRow(SourceTable, SourceName);
+	return FoundRow.IsValid() ? *FoundRow : FDialogueRow::Invalid();
 }
 
 float UMounteaDialogueSystemBFC::GetRowDuration(const FDialogueRowData& Row)
 {
-	float ReturnValue = 1.f;
-	if (!IsDialogueRowDataValid(Row))
-		return ReturnValue;
-	
-	switch (Row.RowDurationMode)
-	{
-		case ERowDurationMode::ERDM_Duration:
-		{
-			if (Row.RowSound)
-			{
-				ReturnValue = Row.RowSound->Duration;
-				break;
-			}
-			ReturnValue =  Row.RowDuration;
-			break;
-		}
-		case ERowDurationMode::EDRM_Override:
-		{
-			ReturnValue = Row.RowDurationOverride;
-			break;
-		}
-		case ERowDurationMode::EDRM_Add:
-		{
-			if (Row.RowSound)
-			{
-				ReturnValue = Row.RowSound->Duration;
-				ReturnValue = ReturnValue + Row.RowDurationOverride;
-				break;
-			}
-			ReturnValue = Row.RowDurationOverride;
-			break;
-		}
-		case ERowDurationMode::ERDM_AutoCalculate:
-		{
-			if (GetDialogueSystemSettings_Internal())
-				ReturnValue= ((Row.RowText.ToString().Len() * GetDialogueSystemSettings_Internal()->GetDurationCoefficient()) / 100.f);
-			else
-				ReturnValue= ((Row.RowText.ToString().Len() * 8.f) / 100.f);
-			break;
-		}
-	}
-
-	// Timer running in background need some time and replication takes a few ms, too
-	ReturnValue = FMath::Max(UE_KINDA_SMALL_NUMBER, ReturnValue);
-		
-	return ReturnValue;
+	return UMounteaDialogueTraversalStatics::GetRowDuration(Row);
 }
 
 TArray<FMounteaDialogueDecorator> UMounteaDialogueSystemBFC::GetAllDialogueDecorators(const UMounteaDialogueGraph* FromGraph)
@@ -762,7 +695,7 @@ TArray<FMounteaDialogueDecorator> UMounteaDialogueSystemBFC::GetAllDialogueDecor
 		
 	Decorators.Append(FromGraph->GetAllDecorators());
 
-	for (const auto& Itr : FromGraph->GetAllNodes())
+	for (const auto& Itr : FromGraph->GetAllNodesView())
 	{
 		if (Itr)
 			Decorators.Append(Itr->GetNodeDecorators());
@@ -885,15 +818,15 @@ ERowExecutionMode UMounteaDialogueSystemBFC::GetActiveRowExecutionMode(UMounteaD
 	if (RowIndex < 0)
 		return result;
 
-	auto activeRow = DialogueContext->GetActiveDialogueRow();
+	const FDialogueRow& activeRow = DialogueContext->GetActiveDialogueRow();
 	if (!activeRow.IsValid())
 		return result;
 
-	const TArray<FDialogueRowData> rowDataArray = activeRow.RowData;
+	const TArray<FDialogueRowData>& rowDataArray = activeRow.RowData;
 	if (!rowDataArray.IsValidIndex(RowIndex))
 		return result;
 
-	auto activeRowData = rowDataArray[RowIndex];
+	const FDialogueRowData& activeRowData = rowDataArray[RowIndex];
 	if (!IsDialogueRowDataValid(activeRowData))
 		return result;
 
@@ -991,7 +924,7 @@ FDialogueRow UMounteaDialogueSystemBFC::GetSpeechData(UMounteaDialogueGraphNode*
 	if (!Node) return FDialogueRow();
 	if (!Node->GetClass()->ImplementsInterface(UMounteaDialogueSpeechDataInterface::StaticClass()))
 		return FDialogueRow();
-	return IMounteaDialogueSpeechDataInterface::Execute_GetSpeechData(Node);
+	return *UMounteaDialogueTraversalStatics::GetSpeechDataShared(Node);
 }
 
 bool UMounteaDialogueSystemBFC::NodeHasSpeechData(UMounteaDialogueGraphNode* Node)
@@ -0,0 +1,55 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Helpers/MounteaDialogueTimerStatics.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
+
+namespace
+{
+	UMounteaDialogueWorldSubsystem* GetTimerSubsystem(const UObject* WorldContextObject)
+	{
+		const UWorld* world = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+		return world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	}
+}
+
+bool UMounteaDialogueTimerStatics::IsDialogueTimerActive(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle)
+{
+	const UMounteaDialogueWorldSubsystem* subsystem = Handle.IsValid() ? GetTimerSubsystem(WorldContextObject) : nullptr;
+	return subsystem && subsystem->IsDialogueTimerActive(Handle);
+}
+
+void UMounteaDialogueTimerStatics::ClearDialogueTimer(const UObject* WorldContextObject, FMounteaDialogueTimerHandle& Handle)
+{
+	if (!Handle.IsValid())
+		return;
+
+	if (UMounteaDialogueWorldSubsystem* subsystem = GetTimerSubsystem(WorldContextObject))
+		subsystem->ClearDialogueTimer(Handle);
+	else
+		Handle.Invalidate();
+}
+
+float UMounteaDialogueTimerStatics::GetDialogueTimerRemaining(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle)
+{
+	const UMounteaDialogueWorldSubsystem* subsystem = Handle.IsValid() ? GetTimerSubsystem(WorldContextObject) : nullptr;
+	return subsystem ? subsystem->GetDialogueTimerRemaining(Handle) : -1.f;
+}
+
+float UMounteaDialogueTimerStatics::GetDialogueTimerElapsed(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle)
+{
+	const UMounteaDialogueWorldSubsystem* subsystem = Handle.IsValid() ? GetTimerSubsystem(WorldContextObject) : nullptr;
+	return subsystem ? subsystem->GetDialogueTimerElapsed(Handle) : -1.f;
+}
@@ -11,7 +11,10 @@
 
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 
+#include "Algo/StableSort.h"
+#include "Data/MounteaDialogueCompiledGraph.h"
 #include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueRowCache.h"
 #include "Engine/DataTable.h"
 #include "Edges/MounteaDialogueGraphEdge.h"
 #include "Graph/MounteaDialogueGraph.h"
@@ -24,35 +27,147 @@
 #include "Settings/MounteaDialogueSystemSettings.h"
 #include "Sound/SoundBase.h"
 
+namespace MounteaDialogueTraversalStatics_Private
+{
+	/**
+	 * Resolves the compiled Graph owning given Node and the Node index within it.
+	 * Fails for Nodes which are not registered within their Graph, callers fall back to the UObject topology.
+	 */
+	static const FMounteaDialogueCompiledGraph* ResolveCompiledNode(const UMounteaDialogueGraphNode* Node, UMounteaDialogueGraph*& OutGraph, int32& OutNodeIndex)
+	{
+		OutGraph = IsValid(Node) ? Node->Graph.Get() : nullptr;
+		OutNodeIndex = INDEX_NONE;
+		if (!IsValid(OutGraph))
+			return nullptr;
+
+		OutNodeIndex = OutGraph->FindNodeIndexByGuid(Node->GetNodeGUID());
+		if (OutNodeIndex == INDEX_NONE)
+			return nullptr;
+
+		const FMounteaDialogueCompiledGraph& compiledGraph = OutGraph->GetCompiledGraph();
+		return compiledGraph.IsValidNodeIndex(OutNodeIndex) ? &compiledGraph : nullptr;
+	}
+
+	static void GetAllowedChildNodeIndices(
+		const FMounteaDialogueCompiledGraph& CompiledGraph,
+		const UMounteaDialogueGraph& Graph,
+		const int32 ParentIndex,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext,
+		TArray<int32, TInlineAllocator<16>>& OutChildIndices)
+	{
+		const int32 slotEnd = CompiledGraph.GetChildSlotEnd(ParentIndex);
+		for (int32 slot = CompiledGraph.GetChildSlotBegin(ParentIndex); slot < slotEnd; ++slot)
+		{
+			const int32 childIndex = CompiledGraph.ChildIndices[slot];
+			if (!Graph.AllNodes.IsValidIndex(childIndex))
+				continue;
+
+			const UMounteaDialogueGraphNode* child = Graph.AllNodes[childIndex];
+			if (!IsValid(child) || !child->CanStartNode())
+				continue;
+
+			if (UMounteaDialogueConditionsStatics::EvaluateConditionOps(CompiledGraph.GetSlotConditionOps(slot), CompiledGraph.GetSlotConditionMode(slot), ConditionContext))
+				OutChildIndices.Add(childIndex);
+		}
+	}
+}
+
 TArray<UMounteaDialogueGraphNode*> UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(
 	const UMounteaDialogueGraphNode* ParentNode,
 	const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext)
 {
-	TArray<UMounteaDialogueGraphNode*> returnNodes;
+	FMounteaDialogueNodeBuffer allowedNodes;
+	GetAllowedChildNodes(ParentNode, ConditionContext, allowedNodes, false);
+	return TArray<UMounteaDialogueGraphNode*>(allowedNodes);
+}
+
+TArray<UMounteaDialogueGraphNode*> UMounteaDialogueTraversalStatics::GetAllowedChildNodesSorted(
+	const UMounteaDialogueGraphNode* ParentNode,
+	const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext)
+{
+	FMounteaDialogueNodeBuffer allowedNodes;
+	GetAllowedChildNodes(ParentNode, ConditionContext, allowedNodes, true);
+	return TArray<UMounteaDialogueGraphNode*>(allowedNodes);
+}
+
+void UMounteaDialogueTraversalStatics::GetAllowedChildNodes(
+	const UMounteaDialogueGraphNode* ParentNode,
+	const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext,
+	FMounteaDialogueNodeBuffer& OutNodes,
+	const bool bSortByExecutionOrder)
+{
+	using namespace MounteaDialogueTraversalStatics_Private;
+
+	OutNodes.Reset();
 	if (!IsValid(ParentNode))
-		return returnNodes;
+		return;
 
-	for (UMounteaDialogueGraphNode* child : ParentNode->GetChildrenNodes())
+	UMounteaDialogueGraph* graph = nullptr;
+	int32 parentIndex = INDEX_NONE;
+	if (const FMounteaDialogueCompiledGraph* compiledGraph = ResolveCompiledNode(ParentNode, graph, parentIndex))
 	{
+		TArray<int32, TInlineAllocator<16>> childIndices;
+		GetAllowedChildNodeIndices(*compiledGraph, *graph, parentIndex, ConditionContext, childIndices);
+
+		// Sort on the Execution Order column, no Node dereference needed
+		if (bSortByExecutionOrder)
+		{
+			Algo::StableSortBy(childIndices, [compiledGraph](const int32 NodeIndex)
+			{
+				return compiledGraph->GetExecutionOrder(NodeIndex);
+			});
+		}
+
+		for (const int32 childIndex : childIndices)
+			OutNodes.Add(graph->AllNodes[childIndex]);
+
+		return;
+	}
+
+	const TConstArrayView<UMounteaDialogueGraphNode*> children = ParentNode->GetChildrenNodesView();
+	for (int32 childIndex = 0; childIndex < children.Num(); ++childIndex)
+	{
+		UMounteaDialogueGraphNode* child = children[childIndex];
 		if (!IsValid(child) || !child->CanStartNode())
 			continue;
 
-		const UMounteaDialogueGraphEdge* const* edgePtr = ParentNode->Edges.Find(child);
-		const UMounteaDialogueGraphEdge* edge = edgePtr ? *edgePtr : nullptr;
-
+		const UMounteaDialogueGraphEdge* edge = ParentNode->GetChildEdge(childIndex);
 		if (UMounteaDialogueConditionsStatics::EvaluateEdgeConditions(edge, ConditionContext))
-			returnNodes.Add(child);
+			OutNodes.Add(child);
 	}
 
-	return returnNodes;
+	if (bSortByExecutionOrder)
+	{
+		Algo::StableSortBy(OutNodes, [](const UMounteaDialogueGraphNode* Node)
+		{
+			return Node->ExecutionOrder;
+		});
+	}
 }
 
 UMounteaDialogueGraphNode* UMounteaDialogueTraversalStatics::GetFirstChildNode(const UMounteaDialogueGraphNode* ParentNode)
 {
+	using namespace MounteaDialogueTraversalStatics_Private;
+
 	if (!IsValid(ParentNode))
 		return nullptr;
 
-	const TArray<UMounteaDialogueGraphNode*>& children = ParentNode->GetChildrenNodes();
+	UMounteaDialogueGraph* graph = nullptr;
+	int32 parentIndex = INDEX_NONE;
+	if (const FMounteaDialogueCompiledGraph* compiledGraph = ResolveCompiledNode(ParentNode, graph, parentIndex))
+	{
+		const TConstArrayView<int32> children = compiledGraph->GetChildIndices(parentIndex);
+		if (children.Num() == 0)
+			return nullptr;
+
+		if (graph->AllNodes.IsValidIndex(children[0]))
+		{
+			UMounteaDialogueGraphNode* firstChild = graph->AllNodes[children[0]];
+			return IsValid(firstChild) && firstChild->CanStartNode() ? firstChild : nullptr;
+		}
+	}
+
+	const TConstArrayView<UMounteaDialogueGraphNode*> children = ParentNode->GetChildrenNodesView();
 	if (!children.IsValidIndex(0) || !IsValid(children[0]))
 		return nullptr;
 
@@ -80,19 +195,34 @@ FDialogueRow UMounteaDialogueTraversalStatics::GetSpeechData(UMounteaDialogueGra
 	if (!Node->GetClass()->ImplementsInterface(UMounteaDialogueSpeechDataInterface::StaticClass()))
 		return FDialogueRow();
 
-	return IMounteaDialogueSpeechDataInterface::Execute_GetSpeechData(Node);
+	return *GetSpeechDataShared(Node);
 }
 
-FDialogueRow UMounteaDialogueTraversalStatics::GetDialogueRow(const UDataTable* SourceTable, FName SourceName)
+TSharedRef<const FDialogueRow> UMounteaDialogueTraversalStatics::GetSpeechDataShared(const UMounteaDialogueGraphNode* Node)
 {
-	if (!SourceTable || SourceName.IsNone())
-		return FDialogueRow::Invalid();
+	if (!IsValid(Node))
+		return FMounteaDialogueRowCache::GetEmptyRow();
+
+	// Blueprint overrides of GetSpeechData still have to go through the interface
+	const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
+	if (dialogueNode && !Node->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IMounteaDialogueSpeechDataInterface, GetSpeechData)))
+		return dialogueNode->GetSharedSpeechData();
+
+	if (!Node->GetClass()->ImplementsInterface(UMounteaDialogueSpeechDataInterface::StaticClass()))
+		return FMounteaDialogueRowCache::GetEmptyRow();
 
-	const FString context;
-	if (const FDialogueRow* rowData = SourceTable->FindRow<FDialogueRow>(SourceName, context))
-		return *rowData;
+	return MakeShared<const FDialogueRow>(IMounteaDialogueSpeechDataInterface::Execute_GetSpeechData(const_cast<UMounteaDialogueGraphNode*>(Node)));
+}
+
+FDialogueRow UMounteaDialogueTraversalStatics::GetDialogueRow(const UDataTable* SourceTable, FName SourceName)
+{
+	return *GetDialogueRowShared(SourceTable, SourceName);
+}
 
-	return FDialogueRow::Invalid();
+TSharedRef<const FDialogueRow> UMounteaDialogueTraversalStatics::GetDialogueRowShared(const UDataTable* SourceTable, FName SourceName)
+{
+	const TSharedPtr<const FDialogueRow> cachedRow = FMounteaDialogueRowCache::FindRow(SourceTable, SourceName);
+	return cachedRow.IsValid() ? cachedRow.ToSharedRef() : FMounteaDialogueRowCache::GetInvalidRow();
 }
 
 bool UMounteaDialogueTraversalStatics::IsDialogueRowValid(const FDialogueRow& Row)
@@ -107,6 +237,37 @@ bool UMounteaDialogueTraversalStatics::IsDialogueRowDataValid(const FDialogueRow
 }
 
 float UMounteaDialogueTraversalStatics::GetRowDuration(const FDialogueRowData& Row)
+{
+	return CalculateRowDuration(Row, FMounteaDialogueRowCache::GetDurationCoefficient());
+}
+
+float UMounteaDialogueTraversalStatics::GetActiveRowDuration(const UMounteaDialogueContext* Context)
+{
+	if (!IsValid(Context))
+		return 1.f;
+
+	const int32 rowDataIndex = Context->ActiveDialogueRowDataIndex;
+	if (!Context->ActiveDialogueRow.RowData.IsValidIndex(rowDataIndex))
+		return 1.f;
+
+	const FDialogueRowData& rowData = Context->ActiveDialogueRow.RowData[rowDataIndex];
+
+	// Row overridden by a decorator is stored in the table handle, otherwise the row comes from the Node itself
+	float rowDuration = 0.f;
+	const FDataTableRowHandle& tableHandle = Context->ActiveDialogueTableHandle;
+	if (tableHandle.DataTable && FMounteaDialogueRowCache::FindRowDuration(tableHandle.DataTable, tableHandle.RowName, rowDataIndex, rowData.RowGUID, rowDuration))
+		return rowDuration;
+
+	if (const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Context->ActiveNode))
+	{
+		if (FMounteaDialogueRowCache::FindRowDuration(dialogueNode->GetDataTable(), dialogueNode->GetRowName(), rowDataIndex, rowData.RowGUID, rowDuration))
+			return rowDuration;
+	}
+
+	return GetRowDuration(rowData);
+}
+
+float UMounteaDialogueTraversalStatics::CalculateRowDuration(const FDialogueRowData& Row, const float DurationCoefficient)
 {
 	float returnValue = 1.f;
 	if (!IsDialogueRowDataValid(Row))
@@ -130,14 +291,8 @@ float UMounteaDialogueTraversalStatics::GetRowDuration(const FDialogueRowData& R
 			returnValue = Row.RowDurationOverride;
 		break;
 	case ERowDurationMode::ERDM_AutoCalculate:
-		{
-			const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
-			if (settings)
-				returnValue = ((Row.RowText.ToString().Len() * settings->GetDurationCoefficient()) / 100.f);
-			else
-				returnValue = ((Row.RowText.ToString().Len() * 8.f) / 100.f);
-			break;
-		}
+		returnValue = ((Row.RowText.ToString().Len() * DurationCoefficient) / 100.f);
+		break;
 	}
 
 	return FMath::Max(UE_KINDA_SMALL_NUMBER, returnValue);
@@ -149,14 +304,20 @@ TArray<FMounteaDialogueDecorator> UMounteaDialogueTraversalStatics::GetAllDialog
 	if (!IsValid(FromGraph))
 		return returnValue;
 
-	returnValue.Append(FromGraph->GetGraphDecorators());
-	const TArray<UMounteaDialogueGraphNode*> allNodes = FromGraph->GetAllNodes();
-	for (UMounteaDialogueGraphNode* node : allNodes)
+	FMounteaDialogueDecoratorBuffer graphDecorators;
+	FromGraph->AppendGraphDecorators(graphDecorators);
+	returnValue.Append(graphDecorators);
+
+	FMounteaDialogueDecoratorBuffer nodeDecorators;
+	for (const UMounteaDialogueGraphNode* node : FromGraph->GetAllNodesView())
 	{
 		if (!IsValid(node))
 			continue;
 
-		returnValue.Append(node->GetNodeDecorators());
+		// Each Node is deduplicated on its own, same as GetNodeDecorators
+		nodeDecorators.Reset();
+		node->AppendNodeDecorators(nodeDecorators);
+		returnValue.Append(nodeDecorators);
 	}
 
 	return returnValue;
@@ -181,6 +342,25 @@ bool UMounteaDialogueTraversalStatics::HasNodeBeenTraversed(
 		});
 }
 
+bool UMounteaDialogueTraversalStatics::HasNodeBeenTraversedInContext(
+	const UMounteaDialogueGraphNode* Node,
+	const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext)
+{
+	if (!IsValid(Node) || !ConditionContext.GetObject())
+		return false;
+
+	const IMounteaDialogueConditionContextInterface* contextInterface = ConditionContext.GetInterface();
+	if (!contextInterface)
+		return HasNodeBeenTraversed(Node, IMounteaDialogueConditionContextInterface::Execute_GetConditionTraversedPath(ConditionContext.GetObject()));
+
+	const FGuid nodeGuid = Node->GetNodeGUID();
+	const FGuid graphGuid = Node->GetGraphGUID();
+	if (!nodeGuid.IsValid() || !graphGuid.IsValid())
+		return false;
+
+	return contextInterface->GetConditionTraverseCount(nodeGuid, graphGuid) > 0;
+}
+
 TScriptInterface<IMounteaDialogueParticipantInterface> UMounteaDialogueTraversalStatics::FindParticipantByTag(
 	const UMounteaDialogueContext* DialogueContext,
 	FGameplayTag SearchTag)
@@ -267,6 +447,7 @@ bool UMounteaDialogueTraversalStatics::UpdateMatchingDialogueParticipant(
 		return false;
 
 	Context->ActiveDialogueParticipant = NewActiveParticipant;
+	Context->MarkConditionStateChanged();
 	Context->OnDialogueContextUpdated.Broadcast();
 	return true;
 }
@@ -0,0 +1,25 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Interfaces/Core/MounteaDialogueConditionContextInterface.h"
+
+int32 IMounteaDialogueConditionContextInterface::GetConditionTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	const TArray<FDialogueTraversePath> traversedPath = Execute_GetConditionTraversedPath(_getUObject());
+	const FDialogueTraversePath* foundEntry = traversedPath.FindByPredicate(
+		[&](const FDialogueTraversePath& Entry)
+		{
+			return Entry.NodeGuid == NodeGuid && Entry.GraphGuid == GraphGuid;
+		});
+
+	return foundEntry ? foundEntry->TraverseCount : 0;
+}
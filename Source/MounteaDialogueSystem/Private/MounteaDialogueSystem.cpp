@@ -3,6 +3,8 @@
 #include "MounteaDialogueSystem.h"
 
 #include "GameplayTagsManager.h"
+#include "Data/MounteaDialogueCompiledGraph.h"
+#include "Data/MounteaDialogueRowCache.h"
 #include "Interfaces/IPluginManager.h"
 
 #define LOCTEXT_NAMESPACE "FMounteaDialogueSystemModule"
@@ -15,12 +17,18 @@ void FMounteaDialogueSystemModule::StartupModule()
 	check(ThisPlugin.IsValid());
 	
 	UGameplayTagsManager::Get().AddTagIniSearchPath(ThisPlugin->GetBaseDir() / TEXT("Config") / TEXT("Tags"));	
+
+	FMounteaDialogueRowCache::Startup();
+	FMounteaDialogueCompiledGraph::Startup();
 }
 
 void FMounteaDialogueSystemModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FMounteaDialogueRowCache::Shutdown();
+	FMounteaDialogueCompiledGraph::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -33,10 +33,10 @@ namespace MounteaDialogueNodeRuntime
 		if (!IsValid(dialogueGraph) || !IsValid(activeNode))
 			return;
 
-		TArray<FMounteaDialogueDecorator> allDecorators;
-		allDecorators.Append(activeNode->GetNodeDecorators());
+		FMounteaDialogueDecoratorBuffer allDecorators;
+		activeNode->AppendNodeDecorators(allDecorators);
 		if (activeNode->DoesInheritDecorators())
-			allDecorators.Append(dialogueGraph->GetGraphDecorators());
+			dialogueGraph->AppendGraphDecorators(allDecorators);
 
 		for (const auto& decorator : allDecorators)
 			decorator.ExecuteDecorator();
@@ -74,6 +74,9 @@ UMounteaDialogueGraphNode::UMounteaDialogueGraphNode(): Graph(nullptr), OwningWo
 void UMounteaDialogueGraphNode::SetNodeGUID(const FGuid& NewGuid)
 {
 	NodeGUID = NewGuid;
+
+	if (Graph)
+		Graph->RebuildNodeIndex();
 }
 
 UMounteaDialogueGraph* UMounteaDialogueGraphNode::GetGraph() const
@@ -81,6 +84,11 @@ UMounteaDialogueGraph* UMounteaDialogueGraphNode::GetGraph() const
 	return Graph;
 }
 
+UMounteaDialogueGraphEdge* UMounteaDialogueGraphNode::GetEdge(const UMounteaDialogueGraphNode* Child) const
+{
+	return Child ? GetChildEdge(ChildrenNodes.IndexOfByKey(Child)) : nullptr;
+}
+
 FGuid UMounteaDialogueGraphNode::GetGraphGUID() const
 {
 	return Graph ? Graph->GetGraphGUID() : FGuid();
@@ -222,16 +230,18 @@ void UMounteaDialogueGraphNode::ProcessNode_Implementation(const TScriptInterfac
 
 TArray<FMounteaDialogueDecorator> UMounteaDialogueGraphNode::GetNodeDecorators() const
 {
-	TArray<FMounteaDialogueDecorator> TempReturn;
-	TArray<FMounteaDialogueDecorator> Return;
-	
-	for (auto Itr : NodeDecorators)
+	FMounteaDialogueDecoratorBuffer nodeDecorators;
+	AppendNodeDecorators(nodeDecorators);
+	return TArray<FMounteaDialogueDecorator>(nodeDecorators);
+}
+
+void UMounteaDialogueGraphNode::AppendNodeDecorators(FMounteaDialogueDecoratorBuffer& OutDecorators) const
+{
+	for (const FMounteaDialogueDecorator& decorator : NodeDecorators)
 	{
-		if (Itr.DecoratorType != nullptr)
-			TempReturn.AddUnique(Itr);
-	}	
-	Return = TempReturn;
-	return Return;
+		if (decorator.DecoratorType != nullptr)
+			OutDecorators.AddUnique(decorator);
+	}
 }
 
 bool UMounteaDialogueGraphNode::CanStartNode_Implementation() const
@@ -248,18 +258,18 @@ bool UMounteaDialogueGraphNode::EvaluateDecorators_Implementation() const
 	}
 	
 	bool bSatisfied = true;
-	TArray<FMounteaDialogueDecorator> AllDecorators;
+	FMounteaDialogueDecoratorBuffer AllDecorators;
 	if (bInheritGraphDecorators)
 	{
 		// Add those Decorators rather than asking Graph to evaluate, because Nodes might introduce specific context
-		AllDecorators.Append(GetGraph()->GetGraphDecorators());
+		GetGraph()->AppendGraphDecorators(AllDecorators);
 	}
 
-	AllDecorators.Append(GetNodeDecorators());
+	AppendNodeDecorators(AllDecorators);
 
 	if (AllDecorators.Num() == 0) return bSatisfied;
 
-	for (auto Itr : AllDecorators)
+	for (const auto& Itr : AllDecorators)
 	{
 		if (Itr.EvaluateDecorator() == false) bSatisfied = false;
 	}
@@ -535,11 +545,25 @@ void UMounteaDialogueGraphNode::OnPasted()
 {
 	NodeGUID = FGuid::NewGuid();
 
+	if (Graph)
+		Graph->RebuildNodeIndex();
+
 	ParentNodes.Empty();
 	ChildrenNodes.Empty();
+	ChildEdges.Empty();
 	Edges.Empty();
 }
 
+void UMounteaDialogueGraphNode::RebuildChildEdges()
+{
+	ChildEdges.Reset(ChildrenNodes.Num());
+	for (UMounteaDialogueGraphNode* child : ChildrenNodes)
+	{
+		UMounteaDialogueGraphEdge* const* edgePtr = child ? Edges.Find(child) : nullptr;
+		ChildEdges.Add(edgePtr ? *edgePtr : nullptr);
+	}
+}
+
 FText UMounteaDialogueGraphNode::GetDefaultTooltipBody() const
 {
 	const FText InheritsValue = bInheritGraphDecorators ? LOCTEXT("True","Yes") : LOCTEXT("False","No");
@@ -3,10 +3,12 @@
 
 #include "Nodes/MounteaDialogueGraphNode_Delay.h"
 
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueSession.h"
 #include "Data/MounteaDialogueContext.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
-#include "TimerManager.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraphNode_DelayNode"
 
@@ -35,11 +37,24 @@ void UMounteaDialogueGraphNode_Delay::ProcessNode_Implementation(const TScriptIn
 {
 	Super::ProcessNode_Implementation(Manager);
 
-	if (GetWorld())
+	UWorld* world = GetWorld();
+	if (UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
 	{
 		FTimerDelegate TimerDelegate_NodeDelay;
 		TimerDelegate_NodeDelay.BindUFunction(this, "OnDelayDurationExpired", Manager);
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle_NodeDelay, TimerDelegate_NodeDelay, DelayDuration, false);
+
+		// Timer handle lives in the Session, so every Session running this Graph gets its own timer
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(Cast<UMounteaDialogueManager>(Manager.GetObject()));
+		FMounteaDialogueNodeInstanceData* nodeData = session ? session->GetInstanceData().FindOrAddNodeData(this) : nullptr;
+		if (nodeData)
+		{
+			subsystem->ClearDialogueTimer(nodeData->DelayTimer);
+			nodeData->DelayTimer = subsystem->SetDialogueTimer(TimerDelegate_NodeDelay, DelayDuration);
+		}
+		else
+		{
+			subsystem->SetDialogueTimer(TimerDelegate_NodeDelay, DelayDuration);
+		}
 	}
 	else
 	{
@@ -66,8 +81,6 @@ void UMounteaDialogueGraphNode_Delay::OnDelayDurationExpired(const TScriptInterf
 		LOG_ERROR(TEXT("[Delay Node Expired] Invalid Child node!"))
 		return;
 	}
-	
-	TimerHandle_NodeDelay.Invalidate();
 
 	auto managerObject = MounteaDialogueManagerInterface.GetObject();
 	if (const auto Context = MounteaDialogueManagerInterface->Execute_GetDialogueContext(managerObject))
@@ -4,10 +4,13 @@
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "TimerManager.h"
 #include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueRowCache.h"
+#include "Graph/MounteaDialogueGraph.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Misc/DataValidation.h"
 #include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraphNode_DialogueNodeBase"
 
@@ -35,9 +38,11 @@ void UMounteaDialogueGraphNode_DialogueNodeBase::ProcessNode_Implementation(cons
 	{
 		if (UMounteaDialogueContext* Context = IMounteaDialogueManagerInterface::Execute_GetDialogueContext(Manager.GetObject()))
 		{
-			GetWorld()->GetTimerManager().ClearTimer(Manager->GetDialogueRowTimerHandle());
+			if (UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
+				subsystem->ClearDialogueTimer(Manager->GetDialogueRowTimer());
 
-			const FDialogueRow DialogueRow = UMounteaDialogueTraversalStatics::GetSpeechData(Context->ActiveNode);
+			const TSharedRef<const FDialogueRow> sharedRow = UMounteaDialogueTraversalStatics::GetSpeechDataShared(Context->ActiveNode);
+			const FDialogueRow& DialogueRow = *sharedRow;
 			if (UMounteaDialogueTraversalStatics::IsDialogueRowValid(DialogueRow) && DialogueRow.RowData.IsValidIndex(Context->GetActiveDialogueRowDataIndex()))
 			{
 				Context->UpdateActiveDialogueRow(DialogueRow);
@@ -66,12 +71,17 @@ void UMounteaDialogueGraphNode_DialogueNodeBase::PreProcessNode_Implementation(c
 
 FDialogueRow UMounteaDialogueGraphNode_DialogueNodeBase::GetSpeechData_Implementation() const
 {
-	if (!IsValid(DataTable))
-		return {};
-	
-	const FString searchContext;
-	const auto returnValue = DataTable->FindRow<FDialogueRow>(RowName, searchContext);
-	return returnValue != nullptr ? *returnValue : FDialogueRow::Invalid();
+	return *GetSharedSpeechData();
+}
+
+TSharedRef<const FDialogueRow> UMounteaDialogueGraphNode_DialogueNodeBase::GetSharedSpeechData() const
+{
+	const UDataTable* dataTable = GetDataTable();
+	if (!IsValid(dataTable))
+		return FMounteaDialogueRowCache::GetEmptyRow();
+
+	const TSharedPtr<const FDialogueRow> cachedRow = FMounteaDialogueRowCache::FindRow(dataTable, GetRowName());
+	return cachedRow.IsValid() ? cachedRow.ToSharedRef() : FMounteaDialogueRowCache::GetInvalidRow();
 }
 
 bool UMounteaDialogueGraphNode_DialogueNodeBase::SetSpeechData_Implementation(const FDialogueRow& NewSpeechData)
@@ -219,6 +229,9 @@ void UMounteaDialogueGraphNode_DialogueNodeBase::PostEditChangeProperty(FPropert
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	if (Graph)
+		Graph->InvalidateCompiledGraph();
+
 	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueGraphNode_DialogueNodeBase, DataTable))
 	{
 		RowName = FName("");
@@ -242,7 +255,8 @@ TArray<FText> UMounteaDialogueGraphNode_DialogueNodeBase::GetPreviews() const
 {
 	TArray<FText> ReturnValues;
 	
-	const FDialogueRow Row = GetSpeechData_Implementation();
+	const TSharedRef<const FDialogueRow> sharedRow = GetSharedSpeechData();
+	const FDialogueRow& Row = *sharedRow;
 	if (UMounteaDialogueTraversalStatics::IsDialogueRowValid(Row))
 	{
 		for (const auto& Itr : Row.RowData)
@@ -17,6 +17,7 @@
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Misc/DataValidation.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraphNode_OpenChildGraph"
 
@@ -55,7 +56,16 @@ void UMounteaDialogueGraphNode_OpenChildGraph::ProcessNode_Implementation(const
 		return;
 	}
 
-	UMounteaDialogueGraph* childGraph = TargetDialogue.LoadSynchronous();
+	UMounteaDialogueGraphRegistrySubsystem* graphRegistry = UMounteaDialogueGraphRegistrySubsystem::Get(Manager.GetObject());
+	UMounteaDialogueGraph* childGraph = graphRegistry ? graphRegistry->FindGraphByAsset(TargetDialogue) : TargetDialogue.Get();
+	if (!IsValid(childGraph))
+	{
+		// Child Graphs are streamed in ahead of time, getting here means preloading was disabled or did not finish
+		LOG_WARNING(TEXT("[Open Child Graph Node] Target dialogue '%s' was not preloaded, loading synchronously."), *TargetDialogue.ToString());
+		childGraph = TargetDialogue.LoadSynchronous();
+		if (graphRegistry)
+			graphRegistry->RegisterGraph(childGraph);
+	}
 	if (!IsValid(childGraph))
 	{
 		LOG_ERROR(TEXT("[Open Child Graph Node] Failed to load target dialogue on node '%s'. Terminating."), *GetName());
@@ -87,9 +97,10 @@ void UMounteaDialogueGraphNode_OpenChildGraph::ProcessNode_Implementation(const
 		return;
 	}
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildren = UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(firstNode, context);
+	FMounteaDialogueNodeBuffer allowedChildren;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(firstNode, context, allowedChildren, false);
 	context->SetDialogueContext(firstNode, allowedChildren);
-	context->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(firstNode));
+	context->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(firstNode));
 	context->UpdateActiveDialogueRowDataIndex(0);
 }
 
@@ -126,8 +137,7 @@ bool UMounteaDialogueGraphNode_OpenChildGraph::ValidateTargetDialogueReference(F
 			continue;
 		visitedGraphs.Add(currentGraph);
 
-		const TArray<UMounteaDialogueGraphNode*> currentNodes = currentGraph->GetAllNodes();
-		for (const auto* Node : currentNodes)
+		for (const UMounteaDialogueGraphNode* Node : currentGraph->GetAllNodesView())
 		{
 			const auto* OpenChildNode = Cast<UMounteaDialogueGraphNode_OpenChildGraph>(Node);
 			if (!IsValid(OpenChildNode))
@@ -3,16 +3,18 @@
 
 #include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
 
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueSession.h"
 #include "Data/MounteaDialogueContext.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Misc/DataValidation.h"
-#include "TimerManager.h"
 #include "Algo/AnyOf.h"
 #include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
 #include "Nodes/MounteaDialogueGraphNode_Delay.h"
 #include "Nodes/MounteaDialogueGraphNode_OpenChildGraph.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraphNode_ReturnToNode"
 
@@ -48,11 +50,24 @@ UMounteaDialogueGraphNode_ReturnToNode::UMounteaDialogueGraphNode_ReturnToNode()
 
 void UMounteaDialogueGraphNode_ReturnToNode::ProcessNode_Implementation(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager)
 {
-	if (GetWorld())
+	UWorld* world = GetWorld();
+	if (UMounteaDialogueWorldSubsystem* subsystem = world ? world->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr)
 	{
-		FTimerDelegate TimerDelegate_TypeWriterUpdateInterval;
-		TimerDelegate_TypeWriterUpdateInterval.BindUFunction(this, "OnDelayDurationExpired", Manager);
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle_Delay, TimerDelegate_TypeWriterUpdateInterval, DelayDuration, false);
+		FTimerDelegate TimerDelegate_Delay;
+		TimerDelegate_Delay.BindUFunction(this, "OnDelayDurationExpired", Manager);
+
+		// Node is shared by every Session running the Graph, the handle belongs to the Session
+		UMounteaDialogueSession* session = subsystem->FindSessionForManager(Cast<UMounteaDialogueManager>(Manager.GetObject()));
+		FMounteaDialogueNodeInstanceData* nodeData = session ? session->GetInstanceData().FindOrAddNodeData(this) : nullptr;
+		if (nodeData)
+		{
+			subsystem->ClearDialogueTimer(nodeData->DelayTimer);
+			nodeData->DelayTimer = subsystem->SetDialogueTimer(TimerDelegate_Delay, DelayDuration);
+		}
+		else
+		{
+			subsystem->SetDialogueTimer(TimerDelegate_Delay, DelayDuration);
+		}
 	}
 	else
 		OnDelayDurationExpired(Manager);
@@ -72,8 +87,10 @@ void UMounteaDialogueGraphNode_ReturnToNode::OnDelayDurationExpired(const TScrip
 
 	if (bAutoCompleteSelectedNode)
 	{
-		Context->SetDialogueContext(SelectedNode, UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(SelectedNode, Context));
-		Context->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(SelectedNode));
+		FMounteaDialogueNodeBuffer allowedChildNodes;
+		UMounteaDialogueTraversalStatics::GetAllowedChildNodes(SelectedNode, Context, allowedChildNodes, false);
+		Context->SetDialogueContext(SelectedNode, allowedChildNodes);
+		Context->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(SelectedNode));
 		Context->UpdateActiveDialogueRowDataIndex(0);
 		IMounteaDialogueManagerInterface::Execute_NodeProcessed(managerObject);
 	}
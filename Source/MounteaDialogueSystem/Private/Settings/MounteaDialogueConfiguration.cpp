@@ -3,6 +3,7 @@
 
 #include "Settings/MounteaDialogueConfiguration.h"
 
+#include "Data/MounteaDialogueRowCache.h"
 #include "Engine/Font.h"
 #include "NativeGameplayTags.h"
 #include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
@@ -242,6 +243,9 @@ void UMounteaDialogueConfiguration::PostEditChangeChainProperty(FPropertyChanged
 	if (SubtitlesSettings.SettingsGUID.IsValid() == false)
 		SubtitlesSettings.SettingsGUID = FGuid::NewGuid();
 
+	if (PropertyChangedEvent.PropertyChain.GetActiveMemberNode()->GetValue()->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueConfiguration, DurationCoefficient))
+		FMounteaDialogueRowCache::InvalidateRowDurations();
+
 	if (PropertyChangedEvent.PropertyChain.GetActiveMemberNode()->GetValue()->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueConfiguration, SubtitlesSettings))
 	{
 		if (SubtitlesSettings.SubtitlesFont.FontObject == nullptr)
@@ -3,6 +3,7 @@
 
 #include "Settings/MounteaDialogueSystemSettings.h"
 
+#include "Data/MounteaDialogueRowCache.h"
 #include "Engine/Font.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Settings/MounteaDialogueConfiguration.h"
@@ -129,10 +130,33 @@ float UMounteaDialogueSystemSettings::GetClientPredictionTimeoutSeconds() const
 	return FMath::Max(0.05f, ClientPredictionTimeoutSeconds);
 }
 
+float UMounteaDialogueSystemSettings::GetEavesdropRadius() const
+{
+	return FMath::Max(0.f, EavesdropRadius);
+}
+
+float UMounteaDialogueSystemSettings::GetEavesdropRefreshInterval() const
+{
+	return FMath::Max(0.1f, EavesdropRefreshInterval);
+}
+
+bool UMounteaDialogueSystemSettings::ShouldPreloadChildGraphsOnSessionStart() const
+{
+	return bPreloadChildGraphsOnSessionStart;
+}
+
+int32 UMounteaDialogueSystemSettings::GetChildGraphPreloadDistance() const
+{
+	return FMath::Max(0, ChildGraphPreloadDistance);
+}
+
 void UMounteaDialogueSystemSettings::SetDialogueConfiguration(const TSoftObjectPtr<UMounteaDialogueConfiguration> NewDialogueConfiguration)
 {
 	if (DialogueConfiguration != NewDialogueConfiguration)
-		DialogueConfiguration = NewDialogueConfiguration;	
+	{
+		DialogueConfiguration = NewDialogueConfiguration;
+		FMounteaDialogueRowCache::InvalidateRowDurations();
+	}
 }
 
 #if WITH_EDITOR
@@ -153,6 +177,9 @@ void UMounteaDialogueSystemSettings::PostEditChangeProperty(FPropertyChangedEven
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	if (PropertyChangedEvent.Property && PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueConfiguration))
+		FMounteaDialogueRowCache::InvalidateRowDurations();
+
 	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueWidgetCommands))
 	{
 		if (DialogueWidgetCommands.Contains(MounteaDialogueWidgetCommands::CreateDialogueWidget) == false)
@@ -0,0 +1,391 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Nodes/MounteaDialogueGraphNode_OpenChildGraph.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+
+void UMounteaDialogueGraphRegistrySubsystem::Deinitialize()
+{
+	for (const auto& pendingLoad : PendingLoads)
+	{
+		if (pendingLoad.Value.IsValid())
+			pendingLoad.Value->CancelHandle();
+	}
+
+	for (const auto& childGraphHandle : ChildGraphHandles)
+	{
+		if (childGraphHandle.Value.IsValid())
+			childGraphHandle.Value->ReleaseHandle();
+	}
+
+	PendingLoads.Empty();
+	ChildGraphHandles.Empty();
+	ChildGraphRequests.Empty();
+	GraphLoadFinishedEvent.Clear();
+	RegisteredGraphs.Empty();
+	GraphGUIDsByPath.Empty();
+
+	Super::Deinitialize();
+}
+
+UMounteaDialogueGraphRegistrySubsystem* UMounteaDialogueGraphRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* world = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMounteaDialogueGraphRegistrySubsystem>() : nullptr;
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::RegisterGraph(UMounteaDialogueGraph* Graph)
+{
+	if (!IsValid(Graph))
+		return;
+
+	const FGuid graphGuid = Graph->GetGraphGUID();
+	if (!graphGuid.IsValid())
+	{
+		LOG_WARNING(TEXT("[Register Graph] Graph '%s' has invalid GUID and cannot be registered."), *Graph->GetName())
+		return;
+	}
+
+	FMounteaDialogueGraphRegistryEntry& entry = RegisteredGraphs.FindOrAdd(graphGuid);
+	if (entry.LoadState == EMounteaDialogueGraphLoadState::Loaded && entry.Graph == Graph)
+		return;
+
+	entry.GraphAsset = Graph;
+	entry.Graph = Graph;
+	entry.LoadState = EMounteaDialogueGraphLoadState::Loaded;
+	entry.ChildGraphGUIDs.Reset();
+	GraphGUIDsByPath.Add(FSoftObjectPath(Graph), graphGuid);
+
+	TArray<UMounteaDialogueGraph*> residentChildGraphs;
+	TArray<FGuid> childGraphGuids;
+	for (const UMounteaDialogueGraphNode* node : Graph->AllNodes)
+	{
+		const UMounteaDialogueGraphNode_OpenChildGraph* openChildNode = Cast<UMounteaDialogueGraphNode_OpenChildGraph>(node);
+		if (!openChildNode || openChildNode->TargetDialogue.IsNull())
+			continue;
+
+		// Get only resolves already resident objects, it never loads
+		if (UMounteaDialogueGraph* childGraph = openChildNode->TargetDialogue.Get())
+		{
+			residentChildGraphs.AddUnique(childGraph);
+			childGraphGuids.AddUnique(childGraph->GetGraphGUID());
+			continue;
+		}
+
+		const FGuid childGraphGuid = RegisterGraphAsset(openChildNode->TargetDialogue);
+		if (childGraphGuid.IsValid())
+			childGraphGuids.AddUnique(childGraphGuid);
+	}
+
+	// Registering children might reallocate the map, so the entry is looked up again
+	RegisteredGraphs.FindChecked(graphGuid).ChildGraphGUIDs = MoveTemp(childGraphGuids);
+
+	for (UMounteaDialogueGraph* childGraph : residentChildGraphs)
+		RegisterGraph(childGraph);
+
+	// Listeners may register further Graphs, no registry record is held at this point
+	GraphLoadFinishedEvent.Broadcast(graphGuid, Graph);
+}
+
+FGuid UMounteaDialogueGraphRegistrySubsystem::RegisterGraphAsset(const TSoftObjectPtr<UMounteaDialogueGraph>& GraphAsset)
+{
+	const FSoftObjectPath graphPath = GraphAsset.ToSoftObjectPath();
+	if (const FGuid* knownGuid = GraphGUIDsByPath.Find(graphPath))
+		return *knownGuid;
+
+	// Graph GUID is AssetRegistrySearchable, read it from the tags instead of loading the asset
+	FGuid graphGuid;
+	if (const IAssetRegistry* assetRegistry = IAssetRegistry::Get())
+	{
+		const FAssetData assetData = assetRegistry->GetAssetByObjectPath(graphPath);
+		FString guidString;
+		if (assetData.IsValid() && assetData.GetTagValue(TEXT("GraphGUID"), guidString))
+			FGuid::Parse(guidString, graphGuid);
+	}
+
+	if (!graphGuid.IsValid())
+	{
+		LOG_WARNING(TEXT("[Register Graph] Unable to resolve GUID of '%s' without loading it."), *graphPath.ToString())
+		return FGuid();
+	}
+
+	GraphGUIDsByPath.Add(graphPath, graphGuid);
+
+	FMounteaDialogueGraphRegistryEntry& entry = RegisteredGraphs.FindOrAdd(graphGuid);
+	entry.GraphAsset = GraphAsset;
+	if (entry.LoadState == EMounteaDialogueGraphLoadState::Unknown)
+		entry.LoadState = EMounteaDialogueGraphLoadState::NotLoaded;
+
+	return graphGuid;
+}
+
+UMounteaDialogueGraph* UMounteaDialogueGraphRegistrySubsystem::FindGraph(const FGuid& GraphGUID) const
+{
+	const FMounteaDialogueGraphRegistryEntry* entry = RegisteredGraphs.Find(GraphGUID);
+	if (!entry)
+		return nullptr;
+
+	if (entry->LoadState == EMounteaDialogueGraphLoadState::Loaded && entry->Graph.IsValid())
+		return entry->Graph.Get();
+
+	// Loaded by someone else since it was registered, or still resident after its handle was released
+	return entry->GraphAsset.Get();
+}
+
+UMounteaDialogueGraph* UMounteaDialogueGraphRegistrySubsystem::FindGraphByAsset(const TSoftObjectPtr<UMounteaDialogueGraph>& GraphAsset)
+{
+	if (GraphAsset.IsNull())
+		return nullptr;
+
+	if (UMounteaDialogueGraph* residentGraph = GraphAsset.Get())
+	{
+		RegisterGraph(residentGraph);
+		return residentGraph;
+	}
+
+	const FGuid graphGuid = RegisterGraphAsset(GraphAsset);
+	FMounteaDialogueGraphRegistryEntry* entry = RegisteredGraphs.Find(graphGuid);
+	return entry ? TryPromoteResidentGraph(*entry) : nullptr;
+}
+
+EMounteaDialogueGraphLoadState UMounteaDialogueGraphRegistrySubsystem::GetGraphLoadState(const FGuid& GraphGUID) const
+{
+	const FMounteaDialogueGraphRegistryEntry* entry = RegisteredGraphs.Find(GraphGUID);
+	if (!entry)
+		return EMounteaDialogueGraphLoadState::Unknown;
+
+	if (entry->GraphAsset.Get())
+		return EMounteaDialogueGraphLoadState::Loaded;
+
+	// Loaded Graph was garbage collected, entry is downgraded on next promotion
+	if (entry->LoadState == EMounteaDialogueGraphLoadState::Loaded && !entry->Graph.IsValid())
+		return EMounteaDialogueGraphLoadState::NotLoaded;
+
+	return entry->LoadState;
+}
+
+bool UMounteaDialogueGraphRegistrySubsystem::RequestGraphLoad(const FGuid& GraphGUID)
+{
+	FMounteaDialogueGraphRegistryEntry* entry = RegisteredGraphs.Find(GraphGUID);
+	if (!entry)
+	{
+		LOG_WARNING(TEXT("[Request Graph Load] Graph '%s' is not known to the registry."), *GraphGUID.ToString())
+		return false;
+	}
+
+	if (TryPromoteResidentGraph(*entry))
+		return true;
+
+	if (entry->LoadState == EMounteaDialogueGraphLoadState::Loading)
+		return true;
+
+	if (entry->GraphAsset.IsNull())
+		return false;
+
+	entry->LoadState = EMounteaDialogueGraphLoadState::Loading;
+
+	FStreamableManager& streamableManager = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> loadHandle = streamableManager.RequestAsyncLoad(
+		entry->GraphAsset.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UMounteaDialogueGraphRegistrySubsystem::HandleGraphLoaded, GraphGUID));
+
+	// Handle might have completed synchronously and the entry is already resolved
+	if (loadHandle.IsValid() && !loadHandle->HasLoadCompleted())
+		PendingLoads.Add(GraphGUID, loadHandle);
+
+	return true;
+}
+
+UMounteaDialogueGraph* UMounteaDialogueGraphRegistrySubsystem::TryPromoteResidentGraph(FMounteaDialogueGraphRegistryEntry& Entry)
+{
+	if (Entry.LoadState == EMounteaDialogueGraphLoadState::Loaded)
+	{
+		if (UMounteaDialogueGraph* loadedGraph = Entry.Graph.Get())
+			return loadedGraph;
+
+		Entry.LoadState = EMounteaDialogueGraphLoadState::NotLoaded;
+		Entry.Graph.Reset();
+	}
+
+	UMounteaDialogueGraph* residentGraph = Entry.GraphAsset.Get();
+	if (residentGraph)
+		RegisterGraph(residentGraph);
+
+	return residentGraph;
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::HandleGraphLoaded(FGuid GraphGUID)
+{
+	PendingLoads.Remove(GraphGUID);
+
+	FMounteaDialogueGraphRegistryEntry* entry = RegisteredGraphs.Find(GraphGUID);
+	if (!entry)
+		return;
+
+	if (!TryPromoteResidentGraph(*entry))
+	{
+		entry->LoadState = EMounteaDialogueGraphLoadState::Failed;
+		LOG_ERROR(TEXT("[Request Graph Load] Failed to load Graph '%s'."), *entry->GraphAsset.ToString())
+		GraphLoadFinishedEvent.Broadcast(GraphGUID, nullptr);
+	}
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::PreloadChildGraphs(UMounteaDialogueGraph* Graph)
+{
+	if (!IsValid(Graph))
+		return;
+
+	RegisterGraph(Graph);
+
+	const FGuid graphGuid = Graph->GetGraphGUID();
+	if (!graphGuid.IsValid())
+		return;
+
+	if (ChildGraphRequests.FindOrAdd(graphGuid)++ > 0)
+		return;
+
+	const TArray<FSoftObjectPath>& childGraphs = Graph->GetChildGraphDependencies();
+	if (childGraphs.Num() == 0)
+		return;
+
+	for (const FSoftObjectPath& childGraphPath : childGraphs)
+	{
+		const FGuid childGraphGuid = RegisterGraphAsset(TSoftObjectPtr<UMounteaDialogueGraph>(childGraphPath));
+		if (FMounteaDialogueGraphRegistryEntry* childEntry = RegisteredGraphs.Find(childGraphGuid))
+		{
+			if (childEntry->LoadState == EMounteaDialogueGraphLoadState::NotLoaded)
+				childEntry->LoadState = EMounteaDialogueGraphLoadState::Loading;
+		}
+	}
+
+	FStreamableManager& streamableManager = UAssetManager::GetStreamableManager();
+	const TSharedPtr<FStreamableHandle> loadHandle = streamableManager.RequestAsyncLoad(
+		childGraphs,
+		FStreamableDelegate::CreateUObject(this, &UMounteaDialogueGraphRegistrySubsystem::HandleChildGraphsLoaded, graphGuid),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (loadHandle.IsValid())
+		ChildGraphHandles.Add(graphGuid, loadHandle);
+}
+
+bool UMounteaDialogueGraphRegistrySubsystem::IsNodeNearChildGraph(const UMounteaDialogueGraphNode* ActiveNode) const
+{
+	if (!IsValid(ActiveNode))
+		return false;
+
+	UMounteaDialogueGraph* graph = ActiveNode->GetGraph();
+	if (!IsValid(graph))
+		return false;
+
+	const int32 nodeIndex = graph->FindNodeIndexByGuid(ActiveNode->GetNodeGUID());
+	if (nodeIndex == INDEX_NONE)
+		return false;
+
+	const int32 distance = graph->GetCompiledGraph().GetOpenChildGraphDistance(nodeIndex);
+	if (distance == INDEX_NONE)
+		return false;
+
+	const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
+	const int32 preloadDistance = settings ? settings->GetChildGraphPreloadDistance() : 2;
+	return distance <= preloadDistance;
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::ReleaseChildGraphs(const FGuid& GraphGUID)
+{
+	int32* requestCount = ChildGraphRequests.Find(GraphGUID);
+	if (!requestCount)
+		return;
+
+	if (--(*requestCount) > 0)
+		return;
+
+	ChildGraphRequests.Remove(GraphGUID);
+
+	TSharedPtr<FStreamableHandle> loadHandle;
+	if (!ChildGraphHandles.RemoveAndCopyValue(GraphGUID, loadHandle) || !loadHandle.IsValid())
+		return;
+
+	if (loadHandle->IsLoadingInProgress())
+		loadHandle->CancelHandle();
+	else
+		loadHandle->ReleaseHandle();
+
+	ReleaseChildGraphEntries(*loadHandle);
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::ReleaseChildGraphEntries(const FStreamableHandle& LoadHandle)
+{
+	TArray<FSoftObjectPath> childGraphPaths;
+	LoadHandle.GetRequestedAssets(childGraphPaths);
+
+	TArray<FGuid> cancelledGraphGuids;
+	for (const FSoftObjectPath& childGraphPath : childGraphPaths)
+	{
+		const FGuid* childGraphGuid = GraphGUIDsByPath.Find(childGraphPath);
+		FMounteaDialogueGraphRegistryEntry* childEntry = childGraphGuid ? RegisteredGraphs.Find(*childGraphGuid) : nullptr;
+		if (!childEntry)
+			continue;
+
+		// Cancelled handle never calls HandleChildGraphsLoaded, unless RequestGraphLoad streams it in as well the entry would stay Loading
+		if (childEntry->LoadState == EMounteaDialogueGraphLoadState::Loading && !PendingLoads.Contains(*childGraphGuid))
+		{
+			childEntry->LoadState = EMounteaDialogueGraphLoadState::NotLoaded;
+			cancelledGraphGuids.Add(*childGraphGuid);
+			continue;
+		}
+
+		if (childEntry->LoadState != EMounteaDialogueGraphLoadState::Loaded)
+			continue;
+
+		// Lookups still resolve the Graph through GraphAsset for as long as something else keeps it resident
+		childEntry->LoadState = EMounteaDialogueGraphLoadState::NotLoaded;
+		childEntry->Graph.Reset();
+	}
+
+	// Listeners may request the Graphs again, no registry record is held at this point
+	for (const FGuid& cancelledGraphGuid : cancelledGraphGuids)
+		GraphLoadFinishedEvent.Broadcast(cancelledGraphGuid, nullptr);
+}
+
+void UMounteaDialogueGraphRegistrySubsystem::HandleChildGraphsLoaded(FGuid GraphGUID)
+{
+	const UMounteaDialogueGraph* graph = FindGraph(GraphGUID);
+	if (!IsValid(graph))
+		return;
+
+	for (const FSoftObjectPath& childGraphPath : graph->GetChildGraphDependencies())
+	{
+		UMounteaDialogueGraph* childGraph = Cast<UMounteaDialogueGraph>(childGraphPath.ResolveObject());
+		if (IsValid(childGraph))
+		{
+			RegisterGraph(childGraph);
+			continue;
+		}
+
+		LOG_WARNING(TEXT("[Preload Child Graphs] Failed to stream in child Graph '%s'."), *childGraphPath.ToString())
+		if (const FGuid* childGraphGuid = GraphGUIDsByPath.Find(childGraphPath))
+		{
+			const FGuid failedGraphGuid = *childGraphGuid;
+			if (FMounteaDialogueGraphRegistryEntry* childEntry = RegisteredGraphs.Find(failedGraphGuid))
+				childEntry->LoadState = EMounteaDialogueGraphLoadState::Failed;
+			GraphLoadFinishedEvent.Broadcast(failedGraphGuid, nullptr);
+		}
+	}
+}
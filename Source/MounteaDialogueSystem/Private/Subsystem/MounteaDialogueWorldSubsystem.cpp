@@ -11,86 +11,280 @@
 
 #include "Subsystem/MounteaDialogueWorldSubsystem.h"
 #include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueParticipant.h"
 #include "Components/MounteaDialogueSession.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Data/MounteaDialogueContext.h"
 #include "Data/MounteaDialogueContextPayload.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
+#include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
 #include "Graph/MounteaDialogueGraph.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Helpers/MounteaDialogueParticipantStatics.h"
 #include "Helpers/MounteaDialogueTraversalStatics.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
 
 void UMounteaDialogueWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	PlayerLogoutHandle = FGameModeEvents::GameModeLogoutEvent.AddUObject(this, &UMounteaDialogueWorldSubsystem::OnPlayerLogout);
 }
 
 void UMounteaDialogueWorldSubsystem::Deinitialize()
 {
+	for (auto& startOperation : PendingStartOperations)
+	{
+		if (startOperation.Value.StreamHandle.IsValid())
+			startOperation.Value.StreamHandle->CancelHandle();
+	}
+	PendingStartOperations.Empty();
+
+	FGameModeEvents::GameModeLogoutEvent.Remove(PlayerLogoutHandle);
+	PlayerLogoutHandle.Reset();
+
 	RegisteredManagers.Empty();
 	ActiveSessions.Empty();
-	ActiveManager.Reset();
-	ActiveSessionGUID.Invalidate();
-	bDialogueLockActive = false;
+	RegisteredSessions.Empty();
+	SessionPool.Empty();
+	SessionLocks.Empty();
+	ManagerLocks.Empty();
+	ParticipantLocks.Empty();
+	GuidAddressedGraphs.Empty();
+	FullRowTables.Empty();
+	ParticipantCache.Empty();
+	DialogueTimers.Reset();
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	FinishedSessionStats.Empty();
+#endif
 
 	Super::Deinitialize();
 }
 
+void UMounteaDialogueWorldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Delta is already dilated, tickables are not ticked while the world is paused
+	DialogueTimers.Advance(DeltaTime);
+}
+
+bool UMounteaDialogueWorldSubsystem::IsTickable() const
+{
+	return DialogueTimers.Num() > 0;
+}
+
+TStatId UMounteaDialogueWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaDialogueWorldSubsystem, STATGROUP_Tickables);
+}
+
+FMounteaDialogueTimerHandle UMounteaDialogueWorldSubsystem::SetDialogueTimer(const FTimerDelegate& Delegate, const float Delay)
+{
+	return DialogueTimers.SetTimer(Delegate, Delay);
+}
+
+void UMounteaDialogueWorldSubsystem::ClearDialogueTimer(FMounteaDialogueTimerHandle& Handle)
+{
+	DialogueTimers.ClearTimer(Handle);
+}
+
 void UMounteaDialogueWorldSubsystem::RegisterManager(UMounteaDialogueManager* Manager)
 {
 	if (!Manager) return;
 	RegisteredManagers.AddUnique(Manager);
 
-	UMounteaDialogueSession* session = GetGameStateSession();
-	if (IsValid(session))
-		session->TryDispatchPendingClientPayload();
+	DispatchPendingClientPayloads(Manager);
 }
 
 void UMounteaDialogueWorldSubsystem::UnregisterManager(UMounteaDialogueManager* Manager)
 {
 	if (!Manager) return;
 
-	if (ActiveManager.Get() == Manager)
-		ReleaseDialogueLock(Manager, ActiveSessionGUID);
+	CancelStartRequest(Manager);
+	ReleaseDialogueLock(Manager);
 
 	RegisteredManagers.Remove(Manager);
 }
 
+void UMounteaDialogueWorldSubsystem::DispatchPendingClientPayloads(const UMounteaDialogueManager* Manager)
+{
+	if (!Manager) return;
+
+	for (UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (IsValid(session) && session->HasPendingClientPayload() && session->GetSessionManager() == Manager)
+			session->TryDispatchPendingClientPayload();
+	}
+}
+
 UMounteaDialogueSession* UMounteaDialogueWorldSubsystem::GetGameStateSession() const
 {
 	AGameStateBase* gameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
 	return gameState ? gameState->FindComponentByClass<UMounteaDialogueSession>() : nullptr;
 }
 
+UMounteaDialogueSession* UMounteaDialogueWorldSubsystem::FindSession(const FGuid& SessionGUID) const
+{
+	if (!SessionGUID.IsValid())
+		return nullptr;
+
+	if (const FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(SessionGUID))
+		return sessionLock->Session.Get();
+
+	// Pooled Sessions keep their last payload, only Sessions with a manager are running
+	for (UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (IsValid(session) && IsValid(session->GetSessionManager()) && session->GetContextPayload().SessionGUID == SessionGUID)
+			return session;
+	}
+
+	return nullptr;
+}
+
+UMounteaDialogueSession* UMounteaDialogueWorldSubsystem::FindSessionForManager(const UMounteaDialogueManager* Manager) const
+{
+	if (!Manager)
+		return nullptr;
+
+	if (const FGuid* sessionGUID = ManagerLocks.Find(TObjectKey<UMounteaDialogueManager>(Manager)))
+	{
+		const FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(*sessionGUID);
+		return sessionLock ? sessionLock->Session.Get() : nullptr;
+	}
+
+	// Clients hold no locks, Session manager is replicated
+	for (UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (IsValid(session) && session->GetSessionManager() == Manager)
+			return session;
+	}
+
+	return nullptr;
+}
+
+UMounteaDialogueSession* UMounteaDialogueWorldSubsystem::FindSessionForParticipant(const UObject* Participant) const
+{
+	if (!Participant)
+		return nullptr;
+
+	if (const FGuid* sessionGUID = ParticipantLocks.Find(TObjectKey<UObject>(Participant)))
+	{
+		const FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(*sessionGUID);
+		return sessionLock ? sessionLock->Session.Get() : nullptr;
+	}
+
+	for (UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (!IsValid(session) || !IsValid(session->GetSessionManager()))
+			continue;
+
+		for (const auto& participant : session->GetContextPayload().DialogueParticipants)
+		{
+			if (participant.GetObject() == Participant)
+				return session;
+		}
+	}
+
+	return nullptr;
+}
+
+TScriptInterface<IMounteaDialogueParticipantInterface> UMounteaDialogueWorldSubsystem::ResolveCachedParticipant(AActor* ParticipantActor)
+{
+	if (!IsValid(ParticipantActor))
+		return nullptr;
+
+	if (const TWeakObjectPtr<UObject>* cachedParticipant = ParticipantCache.Find(ParticipantActor))
+	{
+		if (UObject* participantObject = cachedParticipant->Get())
+			return TScriptInterface<IMounteaDialogueParticipantInterface>(participantObject);
+
+		ParticipantCache.Remove(ParticipantActor);
+	}
+
+	bool bFoundParticipant = false;
+	TScriptInterface<IMounteaDialogueParticipantInterface> participant =
+		UMounteaDialogueParticipantStatics::ResolveParticipantFromActor(ParticipantActor, bFoundParticipant);
+	if (!bFoundParticipant || !participant.GetObject() || !participant.GetInterface())
+		return nullptr;
+
+	// Misses are not cached, participant components might still be added to the actor
+	ParticipantCache.Add(ParticipantActor, participant.GetObject());
+	ParticipantActor->OnEndPlay.AddUniqueDynamic(this, &UMounteaDialogueWorldSubsystem::OnParticipantActorEndPlay);
+	return participant;
+}
+
+void UMounteaDialogueWorldSubsystem::InvalidateParticipantCache(const AActor* ParticipantActor)
+{
+	if (ParticipantActor)
+		ParticipantCache.Remove(ParticipantActor);
+}
+
+void UMounteaDialogueWorldSubsystem::OnParticipantActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	InvalidateParticipantCache(Actor);
+	if (IsValid(Actor))
+		Actor->OnEndPlay.RemoveDynamic(this, &UMounteaDialogueWorldSubsystem::OnParticipantActorEndPlay);
+}
+
+bool UMounteaDialogueWorldSubsystem::IsParticipantLocked(const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant) const
+{
+	return Participant.GetObject() && ParticipantLocks.Contains(TObjectKey<UObject>(Participant.GetObject()));
+}
+
+void UMounteaDialogueWorldSubsystem::RegisterSession(UMounteaDialogueSession* Session)
+{
+	if (!IsValid(Session))
+		return;
+
+	RegisteredSessions.AddUnique(Session);
+
+	const AActor* sessionOwner = Session->GetOwner();
+	if (sessionOwner && sessionOwner->HasAuthority() && !ActiveSessions.Contains(Session))
+		SessionPool.AddUnique(Session);
+}
+
+void UMounteaDialogueWorldSubsystem::UnregisterSession(UMounteaDialogueSession* Session)
+{
+	RegisteredSessions.Remove(Session);
+	SessionPool.Remove(Session);
+	ActiveSessions.Remove(Session);
+}
+
 void UMounteaDialogueWorldSubsystem::HandleStartRequest(UMounteaDialogueManager* Manager, const FDialogueStartRequest& Request)
 {
 	if (!Manager) 
 		return;
 
-	if (!TryAcquireDialogueLock(Manager))
+	// Resolve stage: everything here is already in memory, nothing is loaded
+	const FGuid sessionGUID = FGuid::NewGuid();
+	if (!TryAcquireDialogueLock(Manager, sessionGUID))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] Another dialogue is already active. Only one active dialogue is supported."));
+		// No start operation exists yet, so FinishStartOperation cannot report it
+		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] Manager already runs another dialogue."));
+		OnDialogueStartOperationFinished.Broadcast(Manager, sessionGUID, EMounteaDialogueStartStage::Failed);
 		return;
 	}
 
-	bool bLockAcquired = true;
-	const auto ReleaseLockIfNeeded = [this, &bLockAcquired, Manager]()
-	{
-		if (!bLockAcquired)
-			return;
-
-		ReleaseDialogueLock(Manager);
-		bLockAcquired = false;
-	};
+	FMounteaDialogueStartOperation& newStartOperation = PendingStartOperations.Add(sessionGUID);
+	newStartOperation.Manager = Manager;
+	newStartOperation.Stage = EMounteaDialogueStartStage::Resolve;
 
 	if (!Request.IsValid())
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] Invalid start request. MainParticipantActor must be provided."));
-		ReleaseLockIfNeeded();
+		FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] Invalid start request. MainParticipantActor must be provided."));
 		return;
 	}
 
+	// Participants are resolved through Blueprint interface calls, which may start other dialogues and reallocate the map
 	TScriptInterface<IMounteaDialogueParticipantInterface> playerParticipant;
 	TScriptInterface<IMounteaDialogueParticipantInterface> mainParticipant;
 	TArray<TScriptInterface<IMounteaDialogueParticipantInterface>> allParticipants;
@@ -100,78 +294,232 @@ void UMounteaDialogueWorldSubsystem::HandleStartRequest(UMounteaDialogueManager*
 	if (!ResolveParticipants(Manager, Request, playerParticipant, mainParticipant, allParticipants, errors))
 	{
 		const FText combined = FText::Join(FText::FromString(TEXT("\n")), errors);
-		Manager->GetDialogueFailedEventHandle().Broadcast(combined.ToString());
-		ReleaseLockIfNeeded();
+		FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Failed, combined.ToString());
 		return;
 	}
 
-	UMounteaDialogueSession* session = GetGameStateSession();
-	if (!session)
+	FMounteaDialogueStartOperation* startOperation = PendingStartOperations.Find(sessionGUID);
+	if (!startOperation)
+		return;
+
+	startOperation->MainParticipant = mainParticipant;
+	startOperation->AllParticipants = allParticipants;
+
+	TArray<const UObject*, TInlineAllocator<4>> participantObjects;
+	for (const auto& participant : allParticipants)
+		participantObjects.Add(participant.GetObject());
+
+	FString lockError;
+	if (!TryLockParticipants(sessionGUID, participantObjects, lockError))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] No UMounteaDialogueSession found on GameState. Add the component to your GameState Blueprint."));
-		ReleaseLockIfNeeded();
+		FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Failed, FString::Printf(TEXT("[HandleStartRequest] %s"), *lockError));
 		return;
 	}
 
-	session->SetAuthoritativeManager(Manager);
+	if (!GetWorld()->GetGameState())
+	{
+		FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] No GameState to host Dialogue Sessions."));
+		return;
+	}
 
-	UMounteaDialogueGraph* resolvedGraph = nullptr;
-	const bool bUseGraphOverride = !Request.DialogueGraph.IsNull();
-	if (bUseGraphOverride)
+	UMounteaDialogueGraph* graph = nullptr;
+	if (!Request.DialogueGraph.IsNull())
 	{
-		resolvedGraph = Request.DialogueGraph.LoadSynchronous();
-		if (!IsValid(resolvedGraph))
-		{
-			Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] DialogueGraph override is set but failed to load."));
-			ReleaseLockIfNeeded();
-			return;
-		}
+		UMounteaDialogueGraphRegistrySubsystem* graphRegistry = GetWorld()->GetSubsystem<UMounteaDialogueGraphRegistrySubsystem>();
+		graph = graphRegistry ? graphRegistry->FindGraphByAsset(Request.DialogueGraph) : Request.DialogueGraph.Get();
 	}
 	else
-		resolvedGraph = mainParticipant->Execute_GetDialogueGraph(mainParticipant.GetObject());
+		graph = mainParticipant->Execute_GetDialogueGraph(mainParticipant.GetObject());
+
+	startOperation = PendingStartOperations.Find(sessionGUID);
+	if (!startOperation)
+		return;
+
+	startOperation->GraphAsset = Request.DialogueGraph;
+	startOperation->Graph = graph;
+	if (!IsValid(startOperation->Graph) && startOperation->GraphAsset.IsNull())
+	{
+		FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] Unable to resolve active dialogue graph."));
+		return;
+	}
+
+	StreamStartOperation(sessionGUID);
+}
+
+bool UMounteaDialogueWorldSubsystem::CancelStartRequest(UMounteaDialogueManager* Manager)
+{
+	const FGuid* foundSessionGUID = FindStartOperationGUID(Manager);
+	if (!foundSessionGUID)
+		return false;
+
+	// Key is removed by FinishStartOperation, it must not be passed by reference into the map
+	const FGuid sessionGUID = *foundSessionGUID;
+	FinishStartOperation(sessionGUID, EMounteaDialogueStartStage::Cancelled, TEXT("[HandleStartRequest] Dialogue start has been cancelled."));
+	return true;
+}
+
+bool UMounteaDialogueWorldSubsystem::IsStartRequestPending(const UMounteaDialogueManager* Manager) const
+{
+	return FindStartOperationGUID(Manager) != nullptr;
+}
+
+const FGuid* UMounteaDialogueWorldSubsystem::FindStartOperationGUID(const UMounteaDialogueManager* Manager) const
+{
+	if (!Manager)
+		return nullptr;
+
+	for (const auto& startOperation : PendingStartOperations)
+	{
+		if (startOperation.Value.Manager == Manager)
+			return &startOperation.Key;
+	}
+
+	return nullptr;
+}
+
+void UMounteaDialogueWorldSubsystem::StreamStartOperation(const FGuid& SessionGUID)
+{
+	FMounteaDialogueStartOperation* startOperation = PendingStartOperations.Find(SessionGUID);
+	if (!startOperation)
+		return;
+
+	startOperation->Stage = EMounteaDialogueStartStage::Stream;
+
+	// Data Tables and row sounds are hard references of the Graph, so once the Graph is resident so is the first row
+	if (IsValid(startOperation->Graph))
+	{
+		EvaluateStartOperation(SessionGUID);
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> streamHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		startOperation->GraphAsset.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UMounteaDialogueWorldSubsystem::OnStartOperationStreamed, SessionGUID),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	// Delegate might have already run if the Graph finished loading meanwhile
+	startOperation = PendingStartOperations.Find(SessionGUID);
+	if (!startOperation || startOperation->Stage != EMounteaDialogueStartStage::Stream)
+		return;
+
+	if (!streamHandle.IsValid())
+	{
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] DialogueGraph override is set but failed to load."));
+		return;
+	}
+
+	startOperation->StreamHandle = streamHandle;
+}
+
+void UMounteaDialogueWorldSubsystem::OnStartOperationStreamed(FGuid SessionGUID)
+{
+	FMounteaDialogueStartOperation* startOperation = PendingStartOperations.Find(SessionGUID);
+	if (!startOperation || startOperation->Stage != EMounteaDialogueStartStage::Stream)
+		return;
+
+	startOperation->StreamHandle.Reset();
+	startOperation->Graph = startOperation->GraphAsset.Get();
+	if (!IsValid(startOperation->Graph))
+	{
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] DialogueGraph override is set but failed to load."));
+		return;
+	}
+
+	EvaluateStartOperation(SessionGUID);
+}
+
+void UMounteaDialogueWorldSubsystem::EvaluateStartOperation(const FGuid& SessionGUID)
+{
+	FMounteaDialogueStartOperation* startOperation = PendingStartOperations.Find(SessionGUID);
+	if (!startOperation)
+		return;
 
-	if (!IsValid(resolvedGraph))
+	startOperation->Stage = EMounteaDialogueStartStage::Evaluate;
+
+	// Streaming might have taken a few frames, everything resolved before has to be checked again
+	UMounteaDialogueManager* manager = startOperation->Manager;
+	if (!IsValid(manager))
+	{
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Cancelled, TEXT("[HandleStartRequest] Manager is no longer valid."));
+		return;
+	}
+
+	const TScriptInterface<IMounteaDialogueParticipantInterface> mainParticipant = startOperation->MainParticipant;
+	if (!IsValid(mainParticipant.GetObject()))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] Unable to resolve active dialogue graph."));
-		ReleaseLockIfNeeded();
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] Main participant is no longer valid."));
 		return;
 	}
 
+	TArray<TScriptInterface<IMounteaDialogueParticipantInterface>> allParticipants = startOperation->AllParticipants;
+	allParticipants.RemoveAll([](const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant)
+	{
+		return !IsValid(Participant.GetObject());
+	});
+
+	UMounteaDialogueGraph* resolvedGraph = startOperation->Graph;
+
+	// Conditions, speech data and Session registration below may run Blueprint code, which can start or cancel
+	// other dialogues and reallocate PendingStartOperations and SessionLocks. Map elements are looked up again by key.
+	startOperation = nullptr;
+
+	// Graph and its child Graph links are resolved by GUID from now on
+	if (UMounteaDialogueGraphRegistrySubsystem* graphRegistry = GetWorld()->GetSubsystem<UMounteaDialogueGraphRegistrySubsystem>())
+		graphRegistry->RegisterGraph(resolvedGraph);
+
 	UMounteaDialogueGraphNode* graphStartNode = resolvedGraph->GetStartNode();
 	if (!IsValid(graphStartNode))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed,
 			FString::Printf(TEXT("[HandleStartRequest] Dialogue graph '%s' has no start node."), *resolvedGraph->GetName()));
-		ReleaseLockIfNeeded();
 		return;
 	}
 
 	UMounteaDialogueGraphNode* firstRuntimeNode = UMounteaDialogueTraversalStatics::GetFirstChildNode(graphStartNode);
 	if (!IsValid(firstRuntimeNode))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed,
 			FString::Printf(TEXT("[HandleStartRequest] Dialogue graph '%s' start node has no valid child to begin from."), *resolvedGraph->GetName()));
-		ReleaseLockIfNeeded();
 		return;
 	}
 
+	UMounteaDialogueSession* session = SessionLocks.Contains(SessionGUID) ? AcquirePooledSession() : nullptr;
+	if (!session)
+	{
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] Unable to allocate Dialogue Session on GameState."));
+		return;
+	}
+
+	FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(SessionGUID);
+	if (!sessionLock || !PendingStartOperations.Contains(SessionGUID))
+	{
+		// Cancelled while the new Session began play, the lock does not own the Session yet
+		ReturnPooledSession(session);
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Cancelled, TEXT("[HandleStartRequest] Dialogue start has been cancelled."));
+		return;
+	}
+	sessionLock->Session = session;
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	session->BeginSessionStats(SessionGUID, resolvedGraph);
+#endif
+	MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(session->GetSessionStats(), TEXT("EvaluateStart"));
+
 	// Lift resolved state into the replicated payload.
 	FMounteaDialogueContextPayload payload;
-	payload.SessionGUID = FGuid::NewGuid();
-	ActiveSessionGUID = payload.SessionGUID;
+	payload.SessionGUID = SessionGUID;
 
-	UMounteaDialogueContext* tempContext = NewObject<UMounteaDialogueContext>(Manager);
+	UMounteaDialogueContext* tempContext = NewObject<UMounteaDialogueContext>(manager);
 	if (!IsValid(tempContext))
 	{
-		Manager->GetDialogueFailedEventHandle().Broadcast(TEXT("[HandleStartRequest] Failed to create temporary context."));
-		ReleaseLockIfNeeded();
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Failed, TEXT("[HandleStartRequest] Failed to create temporary context."));
 		return;
 	}
 
 	tempContext->SessionGUID = payload.SessionGUID;
 	tempContext->DialogueParticipants = allParticipants;
 	tempContext->SetDialogueContext(firstRuntimeNode, TArray<UMounteaDialogueGraphNode*>());
-	tempContext->UpdateActiveDialogueRow(UMounteaDialogueTraversalStatics::GetSpeechData(firstRuntimeNode));
+	tempContext->UpdateActiveDialogueRow(*UMounteaDialogueTraversalStatics::GetSpeechDataShared(firstRuntimeNode));
 	tempContext->UpdateActiveDialogueRowDataIndex(0);
 
 	TScriptInterface<IMounteaDialogueParticipantInterface> initialActiveParticipant = mainParticipant;
@@ -179,7 +527,7 @@ void UMounteaDialogueWorldSubsystem::HandleStartRequest(UMounteaDialogueManager*
 		UMounteaDialogueParticipantStatics::GetParticipantByType(
 			allParticipants,
 			EDialogueParticipantType::NPC,
-			Manager);
+			manager);
 	if (rolePreferredParticipant.GetObject() && rolePreferredParticipant.GetInterface())
 		initialActiveParticipant = rolePreferredParticipant;
 
@@ -188,9 +536,8 @@ void UMounteaDialogueWorldSubsystem::HandleStartRequest(UMounteaDialogueManager*
 		UMounteaDialogueTraversalStatics::ResolveActiveParticipant(tempContext);
 	UMounteaDialogueTraversalStatics::UpdateMatchingDialogueParticipant(tempContext, resolvedActiveParticipant);
 
-	TArray<UMounteaDialogueGraphNode*> filteredChildren =
-		UMounteaDialogueTraversalStatics::GetAllowedChildNodesFiltered(firstRuntimeNode, tempContext);
-	UMounteaDialogueTraversalStatics::SortNodes(filteredChildren);
+	FMounteaDialogueNodeBuffer filteredChildren;
+	UMounteaDialogueTraversalStatics::GetAllowedChildNodes(firstRuntimeNode, tempContext, filteredChildren, true);
 	tempContext->UpdateAllowedChildrenNodes(filteredChildren);
 
 	payload.DialogueParticipants = tempContext->DialogueParticipants;
@@ -205,16 +552,57 @@ void UMounteaDialogueWorldSubsystem::HandleStartRequest(UMounteaDialogueManager*
 	payload.ActiveDialogueRow = tempContext->ActiveDialogueRow;
 	payload.ActiveDialogueRowDataIndex = tempContext->ActiveDialogueRowDataIndex;
 
+	startOperation = PendingStartOperations.Find(SessionGUID);
+	sessionLock = SessionLocks.Find(SessionGUID);
+	if (!startOperation || !sessionLock || sessionLock->Session != session)
+	{
+		// Cancelled during evaluation, releasing the lock has already returned the Session to the pool
+		FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Cancelled, TEXT("[HandleStartRequest] Dialogue start has been cancelled."));
+		return;
+	}
+
+	// Commit stage: nothing can fail from here on
+	startOperation->Stage = EMounteaDialogueStartStage::Commit;
+	ActiveSessions.AddUnique(session);
+	session->SetAuthoritativeManager(manager);
+
+	// Preload belongs to the Session, so it is released once the dialogue finalizes
+	const UMounteaDialogueSystemSettings* settings = GetDefault<UMounteaDialogueSystemSettings>();
+	if (settings && settings->ShouldPreloadChildGraphsOnSessionStart())
+		session->PreloadChildGraphs(resolvedGraph);
+
 	// WriteContextPayload replicates to clients and notifies the server-side manager via NotifyLocalManagers.
 	// This guarantees context is live on the server before the state transition below fires PrepareNode.
 	session->WriteContextPayload(MoveTemp(payload));
 
-	ActiveSessions.AddUnique(session);
+	FinishStartOperation(SessionGUID, EMounteaDialogueStartStage::Completed, TEXT("OK"));
+}
+
+void UMounteaDialogueWorldSubsystem::FinishStartOperation(const FGuid& SessionGUID, const EMounteaDialogueStartStage Result, const FString& Message)
+{
+	FMounteaDialogueStartOperation startOperation;
+	if (!PendingStartOperations.RemoveAndCopyValue(SessionGUID, startOperation))
+		return;
+
+	if (startOperation.StreamHandle.IsValid())
+		startOperation.StreamHandle->CancelHandle();
+
+	UMounteaDialogueManager* manager = startOperation.Manager;
+	if (Result == EMounteaDialogueStartStage::Completed)
+	{
+		// State transition happens after payload is written — server context is guaranteed valid by the time
+		// StartDialogue → PrepareNode runs via DialogueStartRequestReceived.
+		if (IsValid(manager))
+			manager->GetDialogueStartRequestedResultEventHandle().Broadcast(true, Message);
+	}
+	else
+	{
+		ReleaseDialogueLock(manager, SessionGUID);
+		if (IsValid(manager))
+			manager->GetDialogueFailedEventHandle().Broadcast(Message);
+	}
 
-	// State transition happens after payload is written — server context is guaranteed valid by the time
-	// StartDialogue → PrepareNode runs via DialogueStartRequestReceived.
-	Manager->GetDialogueStartRequestedResultEventHandle().Broadcast(true, TEXT("OK"));
-	bLockAcquired = false;
+	OnDialogueStartOperationFinished.Broadcast(manager, SessionGUID, Result);
 }
 
 void UMounteaDialogueWorldSubsystem::RequestStartEnvironmentDialogue(UMounteaDialogueManager* Manager, const FDialogueStartRequest& Request)
@@ -328,43 +716,287 @@ bool UMounteaDialogueWorldSubsystem::ResolveParticipants(
 	return true;
 }
 
-bool UMounteaDialogueWorldSubsystem::TryAcquireDialogueLock(UMounteaDialogueManager* Manager)
+bool UMounteaDialogueWorldSubsystem::TryAcquireDialogueLock(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
-	if (!IsValid(Manager))
+	if (!IsValid(Manager) || !SessionGUID.IsValid())
 		return false;
 
-	if (!bDialogueLockActive)
+	const TObjectKey<UMounteaDialogueManager> managerKey(Manager);
+	if (const FGuid* lockedSessionGUID = ManagerLocks.Find(managerKey))
 	{
-		bDialogueLockActive = true;
-		ActiveManager = Manager;
-		ActiveSessionGUID.Invalidate();
-		return true;
+		if (SessionLocks.Contains(*lockedSessionGUID))
+			return false;
+
+		// Lock outlived its Session
+		ManagerLocks.Remove(managerKey);
 	}
 
-	if (!ActiveManager.IsValid())
+	FMounteaDialogueSessionLock& sessionLock = SessionLocks.Add(SessionGUID);
+	sessionLock.Manager = managerKey;
+	ManagerLocks.Add(managerKey, SessionGUID);
+	return true;
+}
+
+bool UMounteaDialogueWorldSubsystem::TryLockParticipants(const FGuid& SessionGUID, TConstArrayView<const UObject*> Participants, FString& OutError)
+{
+	FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(SessionGUID);
+	if (!sessionLock)
+	{
+		OutError = TEXT("Session is not locked.");
+		return false;
+	}
+
+	for (const UObject* participant : Participants)
+	{
+		const FGuid* lockedSessionGUID = participant ? ParticipantLocks.Find(TObjectKey<UObject>(participant)) : nullptr;
+		if (lockedSessionGUID && *lockedSessionGUID != SessionGUID && SessionLocks.Contains(*lockedSessionGUID))
+		{
+			OutError = FString::Printf(TEXT("Participant '%s' is already in another dialogue."), *GetNameSafe(participant));
+			return false;
+		}
+	}
+
+	for (const UObject* participant : Participants)
+	{
+		if (!participant)
+			continue;
+
+		const TObjectKey<UObject> participantKey(participant);
+		ParticipantLocks.Add(participantKey, SessionGUID);
+		sessionLock->Participants.AddUnique(participantKey);
+	}
+
+	return true;
+}
+
+bool UMounteaDialogueWorldSubsystem::IsGuidAddressingRequired(const UNetConnection* Connection, const FGuid& GraphGUID) const
+{
+	const TSet<FGuid>* graphGuids = Connection ? GuidAddressedGraphs.Find(Connection) : nullptr;
+	return graphGuids && graphGuids->Contains(GraphGUID);
+}
+
+void UMounteaDialogueWorldSubsystem::MarkGuidAddressingRequired(const UNetConnection* Connection, const FGuid& GraphGUID)
+{
+	if (!Connection || !GraphGUID.IsValid())
+		return;
+
+	GuidAddressedGraphs.FindOrAdd(Connection).Add(GraphGUID);
+}
+
+void UMounteaDialogueWorldSubsystem::OnPlayerLogout(AGameModeBase* GameMode, AController* Exiting)
+{
+	if (!GameMode || GameMode->GetWorld() != GetWorld())
+		return;
+
+	const APlayerController* playerController = Cast<APlayerController>(Exiting);
+	const UNetConnection* exitingConnection = playerController ? playerController->GetNetConnection() : nullptr;
+
+	// Keys of closed connections cannot be resolved anymore, those are dropped as well
+	const auto isStaleConnection = [exitingConnection](const TObjectKey<UNetConnection>& ConnectionKey)
+	{
+		const UNetConnection* connection = ConnectionKey.ResolveObjectPtr();
+		return !connection || connection == exitingConnection;
+	};
+
+	for (auto connectionIt = GuidAddressedGraphs.CreateIterator(); connectionIt; ++connectionIt)
 	{
-		bDialogueLockActive = false;
-		return TryAcquireDialogueLock(Manager);
+		if (isStaleConnection(connectionIt.Key()))
+			connectionIt.RemoveCurrent();
 	}
 
-	return false;
+	for (auto connectionIt = FullRowTables.CreateIterator(); connectionIt; ++connectionIt)
+	{
+		if (isStaleConnection(connectionIt.Key()))
+			connectionIt.RemoveCurrent();
+	}
+}
+
+bool UMounteaDialogueWorldSubsystem::IsFullRowRequired(const UNetConnection* Connection, const UDataTable* Table) const
+{
+	const TSet<TObjectKey<UDataTable>>* rowTables = Connection ? FullRowTables.Find(Connection) : nullptr;
+	return rowTables && rowTables->Contains(Table);
+}
+
+void UMounteaDialogueWorldSubsystem::MarkFullRowRequired(const UNetConnection* Connection, const UDataTable* Table)
+{
+	if (!Connection || !Table)
+		return;
+
+	FullRowTables.FindOrAdd(Connection).Add(Table);
+}
+
+UMounteaDialogueSession* UMounteaDialogueWorldSubsystem::AcquirePooledSession()
+{
+	while (SessionPool.Num() > 0)
+	{
+		UMounteaDialogueSession* pooledSession = SessionPool.Pop(EAllowShrinking::No);
+		if (IsValid(pooledSession) && !ActiveSessions.Contains(pooledSession))
+			return pooledSession;
+	}
+
+	AGameStateBase* gameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	if (!IsValid(gameState))
+		return nullptr;
+
+	// Session placed on the GameState defines the class, so project specific subclasses keep working
+	const UMounteaDialogueSession* templateSession = GetGameStateSession();
+	UClass* sessionClass = templateSession ? templateSession->GetClass() : UMounteaDialogueSession::StaticClass();
+
+	UMounteaDialogueSession* newSession = NewObject<UMounteaDialogueSession>(gameState, sessionClass, NAME_None, RF_Transient);
+	newSession->SetIsReplicated(true);
+	newSession->RegisterComponent();
+
+	// Registering begins play, which puts the Session into the pool
+	SessionPool.Remove(newSession);
+	return newSession;
+}
+
+void UMounteaDialogueWorldSubsystem::ReturnPooledSession(UMounteaDialogueSession* Session)
+{
+	if (!IsValid(Session))
+		return;
+
+	ActiveSessions.Remove(Session);
+	Session->SetAuthoritativeManager(nullptr);
+	SessionPool.AddUnique(Session);
 }
 
 void UMounteaDialogueWorldSubsystem::ReleaseDialogueLock(UMounteaDialogueManager* Manager, const FGuid& SessionGUID)
 {
-	if (!bDialogueLockActive)
+	FGuid releasedSessionGUID = SessionGUID;
+	if (!releasedSessionGUID.IsValid())
+	{
+		const FGuid* managerSessionGUID = Manager ? ManagerLocks.Find(TObjectKey<UMounteaDialogueManager>(Manager)) : nullptr;
+		if (!managerSessionGUID)
+			return;
+
+		releasedSessionGUID = *managerSessionGUID;
+	}
+
+	const FMounteaDialogueSessionLock* sessionLock = SessionLocks.Find(releasedSessionGUID);
+	if (!sessionLock)
+		return;
+
+	if (Manager && sessionLock->Manager != TObjectKey<UMounteaDialogueManager>(Manager))
+		return;
+
+	ReleaseSessionLock(releasedSessionGUID);
+}
+
+void UMounteaDialogueWorldSubsystem::ReleaseSessionLock(const FGuid& SessionGUID)
+{
+	FMounteaDialogueSessionLock sessionLock;
+	if (!SessionLocks.RemoveAndCopyValue(SessionGUID, sessionLock))
+		return;
+
+	const FGuid* managerSessionGUID = ManagerLocks.Find(sessionLock.Manager);
+	if (managerSessionGUID && *managerSessionGUID == SessionGUID)
+		ManagerLocks.Remove(sessionLock.Manager);
+
+	for (const TObjectKey<UObject>& participantKey : sessionLock.Participants)
+	{
+		const FGuid* participantSessionGUID = ParticipantLocks.Find(participantKey);
+		if (participantSessionGUID && *participantSessionGUID == SessionGUID)
+			ParticipantLocks.Remove(participantKey);
+	}
+
+	ReturnPooledSession(sessionLock.Session.Get());
+}
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+
+void UMounteaDialogueWorldSubsystem::ArchiveSessionStats(const FMounteaDialogueSessionStats& Stats)
+{
+	if (!Stats.IsValid())
 		return;
 
-	if (IsValid(Manager) && ActiveManager.IsValid() && ActiveManager.Get() != Manager)
+	if (FinishedSessionStats.Num() >= MaxFinishedSessionStats)
+		FinishedSessionStats.RemoveAt(0, FinishedSessionStats.Num() - MaxFinishedSessionStats + 1, EAllowShrinking::No);
+
+	FMounteaDialogueSessionStats& archivedStats = FinishedSessionStats.Add_GetRef(Stats);
+	if (archivedStats.EndSeconds <= 0.0)
+		archivedStats.EndSeconds = FPlatformTime::Seconds();
+}
+
+FMounteaDialogueSessionStats* UMounteaDialogueWorldSubsystem::FindSessionStats(const FGuid& SessionGUID)
+{
+	if (!SessionGUID.IsValid())
+		return nullptr;
+
+	// Finished Sessions keep their stats until reused, so closing signals are still counted
+	for (UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (IsValid(session) && session->GetSessionStats().SessionGUID == SessionGUID)
+			return &session->GetSessionStats();
+	}
+
+	return FinishedSessionStats.FindByPredicate([&SessionGUID](const FMounteaDialogueSessionStats& Stats)
+	{
+		return Stats.SessionGUID == SessionGUID;
+	});
+}
+
+void UMounteaDialogueWorldSubsystem::ReportSessionStats(const bool bWriteCsv)
+{
+	const UWorld* world = GetWorld();
+	if (!world || world->GetNetMode() == NM_Client)
+	{
+		LOG_WARNING(TEXT("[Session Stats] Stats are collected by the server."))
 		return;
+	}
+
+	TArray<const FMounteaDialogueSessionStats*> reportedStats;
+	for (const FMounteaDialogueSessionStats& stats : FinishedSessionStats)
+		reportedStats.Add(&stats);
 
-	if (SessionGUID.IsValid() && ActiveSessionGUID.IsValid() && SessionGUID != ActiveSessionGUID)
+	for (const UMounteaDialogueSession* session : RegisteredSessions)
+	{
+		if (IsValid(session) && session->GetSessionStats().IsValid())
+			reportedStats.Add(&session->GetSessionStats());
+	}
+
+	if (reportedStats.IsEmpty())
+	{
+		LOG_INFO(TEXT("[Session Stats] No dialogue has been started yet."))
 		return;
+	}
 
-	bDialogueLockActive = false;
-	ActiveManager.Reset();
-	ActiveSessionGUID.Invalidate();
+	FString csv = FMounteaDialogueSessionStats::GetCsvHeader();
+	for (const FMounteaDialogueSessionStats* stats : reportedStats)
+	{
+		LOG_INFO(TEXT("[Session Stats] %s"), *stats->ToString())
+		if (bWriteCsv)
+			stats->AppendCsvRows(csv);
+	}
 
-	if (UMounteaDialogueSession* session = GetGameStateSession())
-		ActiveSessions.Remove(session);
+	if (!bWriteCsv)
+		return;
+
+	const FString csvPath = FPaths::ProfilingDir() / TEXT("MounteaDialogue") / FString::Printf(TEXT("SessionStats-%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(csv, *csvPath))
+	{
+		LOG_INFO(TEXT("[Session Stats] Stats of %d dialogues written to '%s'."), reportedStats.Num(), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*csvPath))
+	}
+	else
+	{
+		LOG_ERROR(TEXT("[Session Stats] Failed to write '%s'."), *csvPath)
+	}
 }
+
+static FAutoConsoleCommandWithWorldAndArgs GMounteaDialogueSessionStatsCommand(
+	TEXT("Mountea.Dialogue.SessionStats"),
+	TEXT("Logs payload bytes, RPCs, condition evaluations and handler time of running and recently finished dialogues. Usage: Mountea.Dialogue.SessionStats [csv]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UMounteaDialogueWorldSubsystem* subsystem = World ? World->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+		if (!subsystem)
+			return;
+
+		const bool bWriteCsv = Args.ContainsByPredicate([](const FString& Arg)
+		{
+			return Arg.Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+		});
+		subsystem->ReportSessionStats(bWriteCsv);
+	}));
+
+#endif
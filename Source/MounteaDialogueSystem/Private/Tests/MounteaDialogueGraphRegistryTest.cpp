@@ -0,0 +1,102 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MounteaDialogueTestHelpers.h"
+#include "Subsystem/MounteaDialogueGraphRegistrySubsystem.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueGraphRegistryCancelTest, "MounteaDialogue.GraphRegistry.CancelChildGraphLoad",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMounteaDialogueGraphRegistryCancelTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTest;
+
+	// Child Graph does not exist, its loads always end up failed
+	AddExpectedError(TEXT("MounteaDialogueRegistryMissingChild"), EAutomationExpectedErrorFlags::Contains, 0);
+
+	UWorld* world = CreateTestWorld(TEXT("MounteaDialogueGraphRegistryCancelTest"));
+	UMounteaDialogueGraphRegistrySubsystem* registry = world->GetSubsystem<UMounteaDialogueGraphRegistrySubsystem>();
+	if (!TestNotNull(TEXT("Graph Registry"), registry))
+	{
+		DestroyTestWorld(world);
+		return false;
+	}
+
+	const FSoftObjectPath childGraphPath(TEXT("/Game/MounteaDialogueRegistryMissingChild.MounteaDialogueRegistryMissingChild"));
+	const FGuid childGraphGuid = FGuid::NewGuid();
+
+	// Child closure is gathered on save, transient parent gets it assigned directly
+	UMounteaDialogueGraph* parentGraph = CreateEmptyGraph();
+	parentGraph->CompileGraph();
+	const FArrayProperty* dependenciesProperty = FindFProperty<FArrayProperty>(UMounteaDialogueGraph::StaticClass(), TEXT("ChildGraphDependencies"));
+	if (!TestNotNull(TEXT("Child Graph dependencies property"), dependenciesProperty))
+	{
+		DestroyTestWorld(world);
+		return false;
+	}
+	dependenciesProperty->ContainerPtrToValuePtr<TArray<FSoftObjectPath>>(parentGraph)->Add(childGraphPath);
+
+	// Missing asset has no Asset Registry tags to resolve its GUID from
+	registry->GraphGUIDsByPath.Add(childGraphPath, childGraphGuid);
+	FMounteaDialogueGraphRegistryEntry& childEntry = registry->RegisteredGraphs.Add(childGraphGuid);
+	childEntry.GraphAsset = TSoftObjectPtr<UMounteaDialogueGraph>(childGraphPath);
+	childEntry.LoadState = EMounteaDialogueGraphLoadState::NotLoaded;
+
+	TArray<TPair<FGuid, bool>> finishedLoads;
+	const FDelegateHandle loadFinishedHandle = registry->OnGraphLoadFinished().AddLambda([&finishedLoads](const FGuid& GraphGUID, UMounteaDialogueGraph* Graph)
+	{
+		finishedLoads.Emplace(GraphGUID, Graph != nullptr);
+	});
+
+	registry->PreloadChildGraphs(parentGraph);
+	if (registry->GetGraphLoadState(childGraphGuid) != EMounteaDialogueGraphLoadState::Loading)
+	{
+		AddInfo(TEXT("Child Graph load finished synchronously, nothing left to cancel."));
+		registry->OnGraphLoadFinished().Remove(loadFinishedHandle);
+		DestroyTestWorld(world);
+		return true;
+	}
+
+	// Last release cancels the in flight handle
+	finishedLoads.Reset();
+	registry->ReleaseChildGraphs(parentGraph->GetGraphGUID());
+
+	TestTrue(TEXT("Cancelled child Graph is not loaded"), registry->GetGraphLoadState(childGraphGuid) == EMounteaDialogueGraphLoadState::NotLoaded);
+	TestEqual(TEXT("Cancelled load is reported once"), finishedLoads.Num(), 1);
+	if (finishedLoads.Num() == 1)
+	{
+		TestTrue(TEXT("Cancelled load reports the child Graph"), finishedLoads[0].Key == childGraphGuid);
+		TestFalse(TEXT("Cancelled load reports failure"), finishedLoads[0].Value);
+	}
+
+	// Same Graph requested again starts a new load instead of waiting on the cancelled one
+	finishedLoads.Reset();
+	TestTrue(TEXT("Child Graph can be requested again"), registry->RequestGraphLoad(childGraphGuid));
+	FlushAsyncLoading();
+
+	TestTrue(TEXT("Requested child Graph does not stay loading"), registry->GetGraphLoadState(childGraphGuid) != EMounteaDialogueGraphLoadState::Loading);
+	TestTrue(TEXT("Requested child Graph reports its load"), finishedLoads.ContainsByPredicate([&childGraphGuid](const TPair<FGuid, bool>& FinishedLoad)
+	{
+		return FinishedLoad.Key == childGraphGuid;
+	}));
+
+	registry->OnGraphLoadFinished().Remove(loadFinishedHandle);
+	DestroyTestWorld(world);
+	return true;
+}
+
+#endif
@@ -0,0 +1,159 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueParticipant.h"
+#include "Components/MounteaDialogueSession.h"
+#include "Interfaces/Core/MounteaDialogueManagerInterface.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "MounteaDialogueTestHelpers.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
+
+namespace MounteaDialogueSessionScaleTest
+{
+	constexpr int32 SessionCount = 256;
+	constexpr int32 Rounds = 2;
+	constexpr int32 MaxSteps = 32;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSessionScaleTest, "MounteaDialogue.Session.Scale",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMounteaDialogueSessionScaleTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSessionScaleTest;
+	using namespace MounteaDialogueTest;
+
+	UWorld* world = CreateTestWorld(TEXT("MounteaDialogueSessionScaleTest"));
+	UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>();
+	if (!TestNotNull(TEXT("Dialogue World Subsystem"), subsystem))
+	{
+		DestroyTestWorld(world);
+		return false;
+	}
+
+	UMounteaDialogueGraph* graph = CreateScriptedGraph();
+
+	// Every dialogue is started by its own environment Manager against its own participant, through the regular start request
+	TArray<AActor*> testActors;
+	TArray<UMounteaDialogueManager*> testManagers;
+	for (int32 i = 0; i < SessionCount; ++i)
+	{
+		AActor* testActor = world->SpawnActor<AActor>();
+		UMounteaDialogueParticipant* participant = NewObject<UMounteaDialogueParticipant>(testActor);
+		participant->RegisterComponent();
+		IMounteaDialogueParticipantInterface::Execute_SetDialogueGraph(participant, graph);
+
+		UMounteaDialogueManager* manager = NewObject<UMounteaDialogueManager>(testActor);
+		manager->RegisterComponent();
+
+		testActors.Add(testActor);
+		testManagers.Add(manager);
+	}
+
+	const int32 initialSessionCount = subsystem->GetRegisteredSessions().Num();
+	for (int32 round = 0; round < Rounds; ++round)
+	{
+		const double startBegin = FPlatformTime::Seconds();
+		for (int32 i = 0; i < SessionCount; ++i)
+		{
+			FDialogueStartRequest request;
+			request.MainParticipantActorRef = testActors[i];
+			request.DialogueGraph = graph;
+			subsystem->HandleStartRequest(testManagers[i], request);
+		}
+		const double startTime = FPlatformTime::Seconds() - startBegin;
+
+		// Graph is resident, so every start commits synchronously into its own Session
+		TSet<const UMounteaDialogueSession*> usedSessions;
+		for (UMounteaDialogueManager* manager : testManagers)
+		{
+			if (const UMounteaDialogueSession* session = subsystem->FindSessionForManager(manager))
+				usedSessions.Add(session);
+		}
+		TestEqual(FString::Printf(TEXT("Round %d: every dialogue started in its own Session"), round + 1), usedSessions.Num(), SessionCount);
+		TestEqual(FString::Printf(TEXT("Round %d: every started dialogue is active"), round + 1), subsystem->GetActiveSessions().Num(), SessionCount);
+
+		// Participant already taking part in a dialogue must be rejected
+		UMounteaDialogueManager* conflictManager = NewObject<UMounteaDialogueManager>(testActors[1]);
+		conflictManager->RegisterComponent();
+		FDialogueStartRequest conflictRequest;
+		conflictRequest.MainParticipantActorRef = testActors[0];
+		conflictRequest.DialogueGraph = graph;
+		subsystem->HandleStartRequest(conflictManager, conflictRequest);
+		TestNull(FString::Printf(TEXT("Round %d: locked participant is rejected"), round + 1), subsystem->FindSessionForManager(conflictManager));
+		conflictManager->DestroyComponent();
+
+		// Rows are forced to finish and Nodes waiting for a choice take the first option, every dialogue has to reach its Complete Node
+		int32 steps = 0;
+		const double traverseBegin = FPlatformTime::Seconds();
+		for (bool bAnyRunning = true; bAnyRunning && steps < MaxSteps; ++steps)
+		{
+			bAnyRunning = false;
+			for (UMounteaDialogueManager* manager : testManagers)
+			{
+				const UMounteaDialogueSession* session = subsystem->FindSessionForManager(manager);
+				if (!session)
+					continue;
+
+				bAnyRunning = true;
+				const FGuid activeNodeGUID = session->GetContextPayload().ActiveNodeGUID;
+				IMounteaDialogueManagerInterface::Execute_SkipDialogueRow(manager);
+
+				session = subsystem->FindSessionForManager(manager);
+				if (session && session->GetContextPayload().ActiveNodeGUID == activeNodeGUID && session->GetContextPayload().AllowedChildNodeGUIDs.Num() > 0)
+				{
+					// Selection rewrites the payload, the GUID must not be passed by reference into it
+					const FGuid selectedNodeGUID = session->GetContextPayload().AllowedChildNodeGUIDs[0];
+					IMounteaDialogueManagerInterface::Execute_SelectNode(manager, selectedNodeGUID);
+				}
+			}
+		}
+		const double traverseTime = FPlatformTime::Seconds() - traverseBegin;
+
+		int32 unfinishedDialogues = 0;
+		for (UMounteaDialogueManager* manager : testManagers)
+		{
+			if (!subsystem->FindSessionForManager(manager))
+				continue;
+
+			unfinishedDialogues++;
+			IMounteaDialogueManagerInterface::Execute_RequestCloseDialogue(manager);
+		}
+		TestEqual(FString::Printf(TEXT("Round %d: every dialogue completed within %d steps"), round + 1, MaxSteps), unfinishedDialogues, 0);
+
+		// Nothing may outlive the dialogues
+		TestEqual(FString::Printf(TEXT("Round %d: no active Sessions"), round + 1), subsystem->GetActiveSessions().Num(), 0);
+		TestEqual(FString::Printf(TEXT("Round %d: no Session locks"), round + 1), subsystem->SessionLocks.Num(), 0);
+		TestEqual(FString::Printf(TEXT("Round %d: no Manager locks"), round + 1), subsystem->ManagerLocks.Num(), 0);
+		TestEqual(FString::Printf(TEXT("Round %d: no participant locks"), round + 1), subsystem->ParticipantLocks.Num(), 0);
+		TestEqual(FString::Printf(TEXT("Round %d: no pending start operations"), round + 1), subsystem->PendingStartOperations.Num(), 0);
+
+		AddInfo(FString::Printf(TEXT("Round %d: %d dialogues started in %.3f ms, traversed in %d steps taking %.3f ms."),
+			round + 1, usedSessions.Num(), startTime * 1000.0, steps, traverseTime * 1000.0));
+	}
+
+	// Later rounds must be served from the pool
+	const int32 createdSessions = subsystem->GetRegisteredSessions().Num() - initialSessionCount;
+	TestTrue(FString::Printf(TEXT("Pooled Sessions are reused, %d created for %d concurrent dialogues"), createdSessions, SessionCount), createdSessions <= SessionCount);
+
+	for (AActor* testActor : testActors)
+		testActor->Destroy();
+
+	DestroyTestWorld(world);
+	return true;
+}
+
+#endif
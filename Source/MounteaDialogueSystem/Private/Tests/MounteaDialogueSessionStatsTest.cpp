@@ -0,0 +1,204 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Misc/AutomationTest.h"
+
+#include "Data/MounteaDialogueSessionStats.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueParticipant.h"
+#include "Components/MounteaDialogueSession.h"
+#include "Data/MounteaDialogueContextPayload.h"
+#include "Engine/NetSerialization.h"
+#include "Interfaces/Core/MounteaDialogueManagerInterface.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "MounteaDialogueTestHelpers.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
+#include "UObject/CoreNet.h"
+
+namespace MounteaDialogueSessionStatsTest
+{
+	// Upper bounds of a single scripted conversation, a regression in payload rewrites, condition evaluations or RPCs trips them.
+	constexpr int32 MaxPayloadWrites = 12;
+	constexpr int32 MaxConditionEvaluations = 8;
+	constexpr int32 MaxRPCs = 32;
+	constexpr int64 MaxPayloadDeltaBytes = 1024;
+	constexpr int32 MaxSteps = 32;
+	// Frame time of the ticks between steps, far below row durations so timers do not drive the dialogue.
+	constexpr float StepDeltaSeconds = 0.01f;
+
+	/**
+	 * Simulated replication of the Context Payload to a single client, one delta per observed payload state.
+	 * Bare package map writes no object references, so bytes cover GUIDs, rows and versions.
+	 */
+	struct FPayloadReplication
+	{
+		UPackageMap* PackageMap = nullptr;
+		TSharedPtr<INetDeltaBaseState> BaseState;
+		FMounteaDialogueContextPayload ClientPayload;
+		int64 DeltaBytes = 0;
+		int64 FullBytes = 0;
+		int32 Deltas = 0;
+		bool bRoundTripsMatched = true;
+
+		void Replicate(const FMounteaDialogueContextPayload& ServerPayload, UMounteaDialogueGraph* Graph)
+		{
+			FMounteaDialogueContextPayload serverPayload = ServerPayload;
+
+			FBitWriter fullWriter(0, true);
+			bool bFullSuccess = false;
+			serverPayload.NetSerialize(fullWriter, PackageMap, bFullSuccess);
+
+			FBitWriter deltaWriter(0, true);
+			TSharedPtr<INetDeltaBaseState> newBaseState;
+			FNetDeltaSerializeInfo writeParms;
+			writeParms.Writer = &deltaWriter;
+			writeParms.Map = PackageMap;
+			writeParms.OldState = BaseState.Get();
+			writeParms.NewState = &newBaseState;
+			if (!serverPayload.NetDeltaSerialize(writeParms))
+				return;
+
+			BaseState = newBaseState;
+			Deltas++;
+			DeltaBytes += deltaWriter.GetNumBytes();
+			FullBytes += fullWriter.GetNumBytes();
+
+			FBitReader deltaReader(deltaWriter.GetData(), deltaWriter.GetNumBits());
+			FNetDeltaSerializeInfo readParms;
+			readParms.Reader = &deltaReader;
+			readParms.Map = PackageMap;
+			bool bRead = ClientPayload.NetDeltaSerialize(readParms);
+			if (ClientPayload.bNodeAddressingDeferred)
+				bRead &= ClientPayload.ResolveDeferredNodeAddressing(Graph);
+
+			bRoundTripsMatched &= bRead
+				&& ClientPayload.SessionGUID == serverPayload.SessionGUID
+				&& ClientPayload.ActiveNodeGUID == serverPayload.ActiveNodeGUID
+				&& ClientPayload.AllowedChildNodeGUIDs == serverPayload.AllowedChildNodeGUIDs
+				&& ClientPayload.ContextVersion == serverPayload.ContextVersion;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSessionStatsTest, "MounteaDialogue.Session.Stats",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMounteaDialogueSessionStatsTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSessionStatsTest;
+	using namespace MounteaDialogueTest;
+
+	UWorld* world = CreateTestWorld(TEXT("MounteaDialogueSessionStatsTest"));
+	UMounteaDialogueWorldSubsystem* subsystem = world->GetSubsystem<UMounteaDialogueWorldSubsystem>();
+	if (!TestNotNull(TEXT("Dialogue World Subsystem"), subsystem))
+	{
+		DestroyTestWorld(world);
+		return false;
+	}
+
+	UMounteaDialogueGraph* graph = CreateScriptedGraph();
+	TestTrue(TEXT("Scripted Graph can start"), graph->CanStartDialogueGraph());
+
+	AActor* npcActor = world->SpawnActor<AActor>();
+	UMounteaDialogueParticipant* participant = NewObject<UMounteaDialogueParticipant>(npcActor);
+	participant->RegisterComponent();
+	IMounteaDialogueParticipantInterface::Execute_SetDialogueGraph(participant, graph);
+
+	UMounteaDialogueManager* manager = NewObject<UMounteaDialogueManager>(npcActor);
+	manager->RegisterComponent();
+
+	FDialogueStartRequest request;
+	request.MainParticipantActorRef = npcActor;
+	request.DialogueGraph = graph;
+	subsystem->HandleStartRequest(manager, request);
+
+	// Graph is resident, so the start commits synchronously
+	const UMounteaDialogueSession* session = subsystem->FindSessionForManager(manager);
+	if (!TestNotNull(TEXT("Dialogue Session"), session))
+	{
+		DestroyTestWorld(world);
+		return false;
+	}
+	const FGuid sessionGUID = session->GetContextPayload().SessionGUID;
+
+	FPayloadReplication payloadReplication;
+	payloadReplication.PackageMap = NewObject<UPackageMap>();
+	payloadReplication.Replicate(session->GetContextPayload(), graph);
+
+	// Rows are forced to finish and the choice always takes the last option, same as a player skipping through.
+	// World ticks after every step, so queued UI signals are flushed into Client_DispatchUISignalBatch like in a real frame.
+	int32 steps = 0;
+	for (; steps < MaxSteps && session; ++steps)
+	{
+		const FGuid activeNodeGUID = session->GetContextPayload().ActiveNodeGUID;
+		IMounteaDialogueManagerInterface::Execute_SkipDialogueRow(manager);
+		world->Tick(LEVELTICK_All, StepDeltaSeconds);
+
+		session = subsystem->FindSessionForManager(manager);
+		if (session && session->GetContextPayload().ActiveNodeGUID == activeNodeGUID && session->GetContextPayload().AllowedChildNodeGUIDs.Num() > 0)
+		{
+			const FGuid selectedNodeGUID = session->GetContextPayload().AllowedChildNodeGUIDs.Last();
+			IMounteaDialogueManagerInterface::Execute_SelectNode(manager, selectedNodeGUID);
+			world->Tick(LEVELTICK_All, StepDeltaSeconds);
+			session = subsystem->FindSessionForManager(manager);
+		}
+
+		if (session)
+			payloadReplication.Replicate(session->GetContextPayload(), graph);
+	}
+
+	TestNull(TEXT("Dialogue finished within the step budget"), session);
+	if (session)
+		IMounteaDialogueManagerInterface::Execute_RequestCloseDialogue(manager);
+	world->Tick(LEVELTICK_All, StepDeltaSeconds);
+
+	const FMounteaDialogueSessionStats* stats = subsystem->FindSessionStats(sessionGUID);
+	if (TestNotNull(TEXT("Session stats"), stats))
+	{
+		AddInfo(stats->ToString());
+		// Wall clock depends on the machine running the test, it is reported but never asserted
+		AddInfo(FString::Printf(TEXT("Handler time %.3f ms"), stats->GetHandlerMilliseconds()));
+
+		int32 rpcCount = 0;
+		for (const auto& rpc : stats->RPCs)
+			rpcCount += rpc.Value.Count;
+		const FMounteaDialogueSessionStats::FCounter* uiBatches = stats->RPCs.Find(TEXT("Client_DispatchUISignalBatch"));
+
+		TestTrue(TEXT("Dialogue finished"), stats->EndSeconds > 0.0);
+		TestTrue(TEXT("Payload was written"), stats->PayloadWrites > 0);
+		TestTrue(FString::Printf(TEXT("Payload writes %d <= %d"), stats->PayloadWrites, MaxPayloadWrites), stats->PayloadWrites <= MaxPayloadWrites);
+		TestTrue(TEXT("Edge condition was evaluated"), stats->ConditionEvaluations > 0);
+		TestTrue(FString::Printf(TEXT("Condition evaluations %d <= %d"), stats->ConditionEvaluations, MaxConditionEvaluations), stats->ConditionEvaluations <= MaxConditionEvaluations);
+		TestTrue(TEXT("UI signal batches were dispatched"), uiBatches && uiBatches->Count > 0);
+		TestTrue(FString::Printf(TEXT("RPCs %d <= %d"), rpcCount, MaxRPCs), rpcCount <= MaxRPCs);
+		// Standalone world has no connections to replicate to, payload bytes are measured by the simulated client below
+		TestEqual(TEXT("Payload replication without connections"), stats->PayloadReplication.Count, 0);
+	}
+
+	AddInfo(FString::Printf(TEXT("Payload deltas %d: %lld bytes, full serialization %lld bytes"),
+		payloadReplication.Deltas, payloadReplication.DeltaBytes, payloadReplication.FullBytes));
+	TestTrue(TEXT("Payload deltas were written"), payloadReplication.Deltas > 0);
+	TestTrue(TEXT("Payload delta round trips matched"), payloadReplication.bRoundTripsMatched);
+	TestTrue(FString::Printf(TEXT("Payload delta bytes %lld <= %lld"), payloadReplication.DeltaBytes, MaxPayloadDeltaBytes), payloadReplication.DeltaBytes <= MaxPayloadDeltaBytes);
+	TestTrue(FString::Printf(TEXT("Payload deltas %lld bytes < full serialization %lld bytes"), payloadReplication.DeltaBytes, payloadReplication.FullBytes),
+		payloadReplication.DeltaBytes < payloadReplication.FullBytes);
+
+	npcActor->Destroy();
+	DestroyTestWorld(world);
+	return true;
+}
+
+#endif
@@ -0,0 +1,145 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Conditions/MounteaDialogueCondition_OnlyFirstTime.h"
+#include "Edges/MounteaDialogueGraphEdge.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/WorldSettings.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+
+/**
+ * Shared fixtures of the Mountea Dialogue automation tests.
+ * Graphs are built from transient Nodes, so tests do not depend on any content.
+ */
+namespace MounteaDialogueTest
+{
+	template<typename T>
+	T* AddNode(UMounteaDialogueGraph* Graph, UDataTable* RowTable)
+	{
+		T* node = NewObject<T>(Graph);
+		node->Graph = Graph;
+		if (RowTable)
+		{
+			node->SetDataTable(RowTable);
+			node->SetRowName(TEXT("Row"));
+		}
+		Graph->AllNodes.Add(node);
+		return node;
+	}
+
+	inline UMounteaDialogueGraphEdge* LinkNodes(UMounteaDialogueGraph* Graph, UMounteaDialogueGraphNode* Parent, UMounteaDialogueGraphNode* Child)
+	{
+		UMounteaDialogueGraphEdge* edge = NewObject<UMounteaDialogueGraphEdge>(Graph);
+		edge->Graph = Graph;
+		edge->StartNode = Parent;
+		edge->EndNode = Child;
+
+		Parent->ChildrenNodes.Add(Child);
+		Parent->ChildEdges.Add(edge);
+		Child->ParentNodes.Add(Parent);
+		return edge;
+	}
+
+	// Transient Data Table with a single "Row" of two timed rows.
+	inline UDataTable* CreateRowTable()
+	{
+		UDataTable* rowTable = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+		rowTable->RowStruct = FDialogueRow::StaticStruct();
+
+		FDialogueRowData rowData;
+		rowData.RowText = FText::FromString(TEXT("Scripted row"));
+		rowData.RowDurationMode = ERowDurationMode::ERDM_Duration;
+		rowData.RowDuration = 1.f;
+
+		FDialogueRow dialogueRow;
+		dialogueRow.RowTitle = FText::FromString(TEXT("Scripted"));
+		dialogueRow.RowData.Add(rowData);
+		dialogueRow.RowData.Add(rowData);
+		rowTable->AddRow(TEXT("Row"), dialogueRow);
+		return rowTable;
+	}
+
+	// Transient Graph with only its Start Node, callers add Nodes and compile it.
+	inline UMounteaDialogueGraph* CreateEmptyGraph()
+	{
+		UMounteaDialogueGraph* graph = NewObject<UMounteaDialogueGraph>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		// Editor Graphs create their Start Node on construction
+		if (!graph->StartNode)
+		{
+			UMounteaDialogueGraphNode_StartNode* startNode = AddNode<UMounteaDialogueGraphNode_StartNode>(graph, nullptr);
+			graph->StartNode = startNode;
+			graph->RootNodes.Add(startNode);
+		}
+		return graph;
+	}
+
+	/**
+	 * Start -> Lead (2 rows) -> Answer A | Answer B -> Lead (2 rows) -> Complete.
+	 * Every dialogue Node shares one transient Data Table row, the edge to Answer B is gated by Only First Time.
+	 */
+	inline UMounteaDialogueGraph* CreateScriptedGraph()
+	{
+		UDataTable* rowTable = CreateRowTable();
+		UMounteaDialogueGraph* graph = CreateEmptyGraph();
+
+		UMounteaDialogueGraphNode_LeadNode* openingNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(graph, rowTable);
+		UMounteaDialogueGraphNode_AnswerNode* answerA = AddNode<UMounteaDialogueGraphNode_AnswerNode>(graph, rowTable);
+		UMounteaDialogueGraphNode_AnswerNode* answerB = AddNode<UMounteaDialogueGraphNode_AnswerNode>(graph, rowTable);
+		UMounteaDialogueGraphNode_LeadNode* closingNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(graph, rowTable);
+		UMounteaDialogueGraphNode_CompleteNode* completeNode = AddNode<UMounteaDialogueGraphNode_CompleteNode>(graph, rowTable);
+
+		LinkNodes(graph, graph->StartNode, openingNode);
+		LinkNodes(graph, openingNode, answerA);
+		UMounteaDialogueGraphEdge* conditionalEdge = LinkNodes(graph, openingNode, answerB);
+		LinkNodes(graph, answerA, closingNode);
+		LinkNodes(graph, answerB, closingNode);
+		LinkNodes(graph, closingNode, completeNode);
+
+		FMounteaDialogueCondition& rule = conditionalEdge->EdgeConditions.Rules.AddDefaulted_GetRef();
+		rule.ConditionClass = NewObject<UMounteaDialogueCondition_OnlyFirstTime>(conditionalEdge);
+
+		graph->CompileGraph();
+		return graph;
+	}
+
+	// Standalone world with a GameState to host Sessions, begun play so components run their BeginPlay.
+	inline UWorld* CreateTestWorld(const TCHAR* WorldName)
+	{
+		UWorld* world = UWorld::CreateWorld(EWorldType::Game, false, WorldName);
+		FWorldContext& worldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		worldContext.SetCurrentWorld(world);
+
+		world->InitializeActorsForPlay(FURL());
+		world->SetGameState(world->SpawnActor<AGameStateBase>());
+		world->GetWorldSettings()->NotifyBeginPlay();
+		return world;
+	}
+
+	inline void DestroyTestWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+}
+
+#endif
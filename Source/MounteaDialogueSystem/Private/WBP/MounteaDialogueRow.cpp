@@ -1,7 +1,8 @@
 ﻿// All rights reserved Dominik Morse (Pavlicek) 2024.
 
 #include "WBP/MounteaDialogueRow.h"
-#include "TimerManager.h"
+
+#include "Subsystem/MounteaDialogueWorldSubsystem.h"
 
 UMounteaDialogueRow::UMounteaDialogueRow(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -22,7 +23,8 @@ void UMounteaDialogueRow::StartTypeWriterEffect_Implementation(const FText& Sour
 		return;
 	}
 
-	if (!GetWorld())
+	UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	if (!subsystem)
 	{
 		return;
 	}
@@ -33,11 +35,11 @@ void UMounteaDialogueRow::StartTypeWriterEffect_Implementation(const FText& Sour
 
 	FTimerDelegate TimerDelegate_TypeWriterUpdateInterval;
 	TimerDelegate_TypeWriterUpdateInterval.BindUFunction(this, "UpdateTypeWriterEffect_Callback", SourceText, 0, Duration);
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle_TypeWriterUpdateInterval, TimerDelegate_TypeWriterUpdateInterval, updateInterval, false);
+	TimerHandle_TypeWriterUpdateInterval = subsystem->SetDialogueTimer(TimerDelegate_TypeWriterUpdateInterval, updateInterval);
 
 	FTimerDelegate TimerDelegate_TypeWriterDuration;
 	TimerDelegate_TypeWriterDuration.BindUFunction(this, "CompleteTypeWriterEffect_Callback", SourceText);
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle_TypeWriterDuration, TimerDelegate_TypeWriterDuration, Duration, false);
+	TimerHandle_TypeWriterDuration = subsystem->SetDialogueTimer(TimerDelegate_TypeWriterDuration, Duration);
 }
 
 void UMounteaDialogueRow::EnableTypeWriterEffect_Implementation(bool bEnable)
@@ -55,7 +57,8 @@ void UMounteaDialogueRow::UpdateTypeWriterEffect_Callback(const FText& SourceTex
 	const FString sourceTextString = SourceText.ToString();
 	const int32 totalCharacters = sourceTextString.Len();
 	
-	if (!GetWorld() || CurrentCharacterIndex >= totalCharacters)
+	UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	if (!subsystem || CurrentCharacterIndex >= totalCharacters)
 	{
 		return;
 	}
@@ -65,25 +68,26 @@ void UMounteaDialogueRow::UpdateTypeWriterEffect_Callback(const FText& SourceTex
 	FString updatedSourceString = sourceTextString.Left(CurrentCharacterIndex);
 	FText updatedSourceText = FText::FromString(updatedSourceString);
 
-	const float ElapsedTime = GetWorld()->GetTimerManager().GetTimerElapsed(TimerHandle_TypeWriterDuration);
+	const float ElapsedTime = subsystem->GetDialogueTimerElapsed(TimerHandle_TypeWriterDuration);
 	const float Alpha = ElapsedTime / TotalDuration;
 
 	OnTypeWriterEffectUpdated(updatedSourceText, Alpha);
 	
 	FTimerDelegate TimerDelegate_TypeWriterUpdateInterval;
 	TimerDelegate_TypeWriterUpdateInterval.BindUFunction(this, "UpdateTypeWriterEffect_Callback", SourceText, CurrentCharacterIndex, TotalDuration);
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle_TypeWriterUpdateInterval, TimerDelegate_TypeWriterUpdateInterval, TotalDuration / totalCharacters, false);
+	TimerHandle_TypeWriterUpdateInterval = subsystem->SetDialogueTimer(TimerDelegate_TypeWriterUpdateInterval, TotalDuration / totalCharacters);
 }
 
 void UMounteaDialogueRow::CompleteTypeWriterEffect_Callback(const FText& SourceText)
 {
-	if (!GetWorld())
+	UMounteaDialogueWorldSubsystem* subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaDialogueWorldSubsystem>() : nullptr;
+	if (!subsystem)
 	{
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_TypeWriterUpdateInterval);
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_TypeWriterDuration);
+	subsystem->ClearDialogueTimer(TimerHandle_TypeWriterUpdateInterval);
+	subsystem->ClearDialogueTimer(TimerHandle_TypeWriterDuration);
 
 	OnTypeWriterEffectUpdated(SourceText, 1.0f);
 	OnTypeWriterEffectFinished();
@@ -70,7 +70,7 @@ public:
 	{ return OnDialogueManagerStateChanged; };
 	virtual FDialogueWidgetCommand& GetDialogueWidgetCommandHandle() override
 	{ return OnDialogueWidgetCommandRequested; };
-	virtual FTimerHandle& GetDialogueRowTimerHandle() override
+	virtual FMounteaDialogueTimerHandle& GetDialogueRowTimer() override
 	{ return TimerHandle_RowTimer; };
 	virtual FDialogueUISignalEvent& GetDialogueUISignalEventHandle() override
 	{ return OnDialogueUISignalRequested; };
@@ -152,7 +152,7 @@ public:
 	 * Delivers a version-stamped UI signal to the owning client.
 	 * Broadcasts OnDialogueUISignalRequested locally on the client.
 	 * On a listen server the _Implementation fires in-process — host is treated as a client.
-	 * Called by UMounteaDialogueSession after payload writes to notify UI of state changes.
+	 * Sends the signal immediately, UMounteaDialogueSession batches its signals through QueueUISignal instead.
 	 *
 	 * @param Signal  Version-stamped UI command to deliver.
 	 */
@@ -168,8 +168,36 @@ public:
 	UFUNCTION(Client, Reliable)
 	void Client_ClearUISignals(const FGuid& SessionGUID);
 
+	/**
+	 * Server-only. Queues a UI signal for the owning client.
+	 * Signals queued within a frame are sent together by Client_DispatchUISignalBatch once actors ticked,
+	 * equal signals for the same Context version are sent once.
+	 *
+	 * @param Signal  Version-stamped UI command to deliver.
+	 */
+	void QueueUISignal(const FMounteaDialogueUISignal& Signal);
+
+	/**
+	 * Server-only. Queues the clear sentinel for given Session, ordered after signals already queued.
+	 *
+	 * @param SessionGUID  Session whose queued signals should be discarded.
+	 */
+	void QueueClearUISignals(const FGuid& SessionGUID);
+
+	/**
+	 * Delivers UI signals queued by the server during one frame, in queued order.
+	 * Broadcasts OnDialogueUISignalRequested locally on the client for each signal.
+	 *
+	 * @param Batch  Signals to deliver.
+	 */
+	UFUNCTION(Client, Reliable)
+	void Client_DispatchUISignalBatch(const FMounteaDialogueUISignalBatch& Batch);
+
 private:
 
+	// Sends queued UI signals, bound to the world post actor tick only while signals are queued.
+	void FlushUISignals(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
 	UFUNCTION(Server, Reliable)
 	void SetManagerState_Server(const EDialogueManagerState NewState);
 	UFUNCTION(Server, Unreliable)
@@ -208,6 +236,20 @@ private:
 
 	UFUNCTION(Server, Reliable)
 	void CleanupDialogue_Server();
+
+	/**
+	 * Client reports its copy of the Graph does not match the server one,
+	 * Node references of the Graph are then sent by GUID to this connection.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ReportNodeAddressingMismatch_Server(FGuid SessionGUID, FGuid GraphGUID);
+
+	/**
+	 * Client reports it cannot resolve the active Dialogue Row from its row cache,
+	 * rows of the Data Table are then sent in full to this connection.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ReportUnresolvedDialogueRow_Server(FGuid SessionGUID, UDataTable* RowTable);
 	
 	UFUNCTION()
 	void OnRep_ManagerState();
@@ -397,13 +439,16 @@ protected:
 	 * Once expires, Dialogue Row is finished.
 	 * 
 	 * ❔ Expiration is driven by Dialogue data Duration variable
+	 * ❔ Runs on the World Subsystem dialogue timers
 	 */
 	UPROPERTY(Transient, VisibleAnywhere, Category="Mountea|Dialogue|Manager", AdvancedDisplay, 
 		meta=(DisplayThumbnail=false))
-	FTimerHandle TimerHandle_RowTimer;
+	FMounteaDialogueTimerHandle TimerHandle_RowTimer;
 	FTimerHandle PendingPredictionHandle;
 
 	bool bParticipantsStarted = false;
+	FMounteaDialogueUISignalBatch PendingUISignals;
+	FDelegateHandle UISignalFlushHandle;
 	int32 LastReceivedPayloadVersion = 0;
 	FGuid LastClientSyncSessionGUID;
 	FGuid LastPlayedAudioRowGUID;
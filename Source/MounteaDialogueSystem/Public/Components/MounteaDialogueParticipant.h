@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Data/MounteaDialogueCompactTraversedPath.h"
+#include "Data/MounteaDialogueTraversalIndex.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
 #include "Interfaces/Core/MounteaDialogueTickableObject.h"
 #include "MounteaDialogueParticipant.generated.h"
@@ -32,6 +34,8 @@ public:
 protected:
 		
 	virtual void BeginPlay() override;	
+	virtual void OnUnregister() override;
+	virtual void Serialize(FArchive& Ar) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -168,11 +172,28 @@ protected:
 	/**
 	 * Contains mapped list of Traversed Nodes by GUIDs.
 	 * To update Performance, this Path is updated only once Dialogue has finished. Temporary Path is stored in Dialogue Context.
+	 * ❔ Rebuilt from Compact Traversed Path, which is what gets saved and replicated. Only read by save games written before it existed.
+	 * ❗ Write through SaveTraversedPath, direct changes are not saved.
 	 */
-	UPROPERTY(Replicated, SaveGame, VisibleAnywhere, Category="Dialogue|Participant", AdvancedDisplay, 
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="Dialogue|Participant", AdvancedDisplay, 
 		meta=(NoResetToDefault))
 	TArray<FDialogueTraversePath> TraversedPath;
 
+	// Saved and replicated form of Traversed Path, a bit per Node of each traversed Graph.
+	UPROPERTY(ReplicatedUsing=OnRep_CompactTraversedPath, SaveGame)
+	FMounteaDialogueCompactTraversedPath CompactTraversedPath;
+
+	// Compact Traversed Path contains Graphs which were not loaded when Traversed Path was rebuilt.
+	bool bTraversedPathPending = false;
+
+	// Bound to the Graph Registry while Traversed Path is pending.
+	FDelegateHandle TraversedGraphRegisteredHandle;
+
+protected:
+
+	// Lookup of Traversed Path entries by Node and Graph GUIDs.
+	FMounteaDialogueTraversalIndex TraversedPathIndex;
+
 private:
 
 	UPROPERTY(Transient, BlueprintReadOnly, Category="Dialogue|Participant", 
@@ -289,11 +310,12 @@ public:
 	virtual AActor* GetOwningActor_Implementation() const override
 	{ return GetOwner();	};
 	
-	virtual TArray<FDialogueTraversePath> GetTraversedPath_Implementation() const override
-	{ return TraversedPath; };
+	virtual TArray<FDialogueTraversePath> GetTraversedPath_Implementation() const override;
 	
 	virtual void SaveTraversedPath_Implementation(TArray<FDialogueTraversePath>& InPath) override;
 
+	virtual int32 GetNodeTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const override;
+
 	virtual FGameplayTag GetParticipantTag_Implementation() const override
 	{ return ParticipantTag; };
 
@@ -354,6 +376,14 @@ protected:
 	void OnRep_DialogueGraph();
 	UFUNCTION()
 	void OnRep_ParticipantState();
+	UFUNCTION()
+	void OnRep_CompactTraversedPath();
+	// Rebuilds Traversed Path from Compact Traversed Path.
+	void RefreshTraversedPath();
+	// Rebuilds Traversed Path once a Graph it is missing becomes resident.
+	void OnTraversedGraphRegistered(const FGuid& GraphGuid, UMounteaDialogueGraph* Graph);
+	// Resolves Graphs of traversed Nodes, Dialogue Graph first, then Graphs known to the Graph Registry.
+	const UMounteaDialogueGraph* FindTraversedGraph(const FGuid& GraphGuid) const;
 	UFUNCTION(Server, Reliable)
 	void SetParticipantState_Server(const EDialogueParticipantState NewState);
 	UFUNCTION(Server, Reliable)
@@ -17,6 +17,7 @@
 #include "MounteaDialogueParticipantUserInterfaceComponent.generated.h"
 
 struct FMounteaDialogueContextPayload;
+class UMounteaDialogueSession;
 /**
  * Mountea Dialogue Participant User Interface Component.
  *
@@ -134,6 +135,9 @@ private:
 	 */
 	void DrainPendingSignals(int32 CurrentVersion, const FGuid& SessionGUID);
 
+	// Returns the Session run by the bound manager, null if there is none.
+	const UMounteaDialogueSession* FindParentManagerSession() const;
+
 	// --- Signal queue state (non-replicated) ------------------------------------
 
 	TArray<FMounteaDialogueUISignal> PendingUISignals;
@@ -13,14 +13,21 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Data/MounteaDialogueConditionCache.h"
 #include "Data/MounteaDialogueContextPayload.h"
+#include "Data/MounteaDialogueSessionInstanceData.h"
+#include "Data/MounteaDialogueSessionStats.h"
+#include "Data/MounteaDialogueTraversalIndex.h"
 #include "Interfaces/Core/MounteaDialogueConditionContextInterface.h"
 #include "MounteaDialogueSession.generated.h"
 
 class UMounteaDialogueWorldSubsystem;
 class UMounteaDialogueManager;
+class UMounteaDialogueGraph;
 class UMounteaDialogueGraphNode;
 class UMounteaDialogueContext;
+class UMounteaDialogueDecoratorBase;
+class APlayerController;
 
 /**
  * UMounteaDialogueSession is the server-authoritative state machine for a single active dialogue.
@@ -28,6 +35,7 @@ class UMounteaDialogueContext;
  * and replicates state to all connected clients through GameState.
  *
  * This component is intended to be attached to AGameState.
+ * The World Subsystem pools Sessions, one per running dialogue, creating more on the GameState when needed.
  *
  * @see FMounteaDialogueContextPayload
  * @see UMounteaDialogueWorldSubsystem
@@ -47,6 +55,7 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
@@ -62,6 +71,16 @@ private:
 	UFUNCTION()
 	void OnRep_ContextPayload();
 
+	/**
+	 * Manager owning the running dialogue, null while the Session is pooled.
+	 * Clients only deliver payloads of Sessions owned by their local manager.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_SessionManager)
+	TObjectPtr<UMounteaDialogueManager> SessionManager = nullptr;
+
+	UFUNCTION()
+	void OnRep_SessionManager();
+
 public:
 
 	/**
@@ -74,17 +93,25 @@ public:
 	}
 
 	/**
-	 * Client-only retry path for payload delivery when OnRep fired before local manager registration.
+	 * Client-only delivery of a payload which replicated before its local manager registered.
+	 * Called on manager and UI registration events, there is no retry timer.
 	 * Safe to call repeatedly; no-op if no pending payload exists.
 	 */
 	void TryDispatchPendingClientPayload();
 
+	bool HasPendingClientPayload() const
+	{ return bClientDispatchPending; };
+
 	/**
 	 * Sets the server-authoritative manager that owns the active session flow.
 	 * The server notify path targets this manager directly to avoid local-player filtering issues.
+	 * Manager is replicated as the Session Manager, null returns the Session to its pooled state.
 	 */
 	void SetAuthoritativeManager(UMounteaDialogueManager* Manager);
 
+	UMounteaDialogueManager* GetSessionManager() const
+	{ return SessionManager; };
+
 	/**
 	 * Server-only session finalize hook.
 	 * Persists traversed-path data for all participants in the current payload and
@@ -100,6 +127,83 @@ public:
 	 */
 	void WriteContextPayload(FMounteaDialogueContextPayload NewPayload);
 
+	/**
+	 * Returns runtime state of Nodes and Decorators owned by this Session.
+	 * Graph assets are shared between Sessions, anything mutable per dialogue belongs here.
+	 */
+	FMounteaDialogueSessionInstanceData& GetInstanceData()
+	{ return InstanceData; };
+
+	const FMounteaDialogueSessionInstanceData& GetInstanceData() const
+	{ return InstanceData; };
+
+	/**
+	 * Returns how many times given Node became active in this Session.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Session",
+		meta=(CustomTag="MounteaK2Getter"))
+	int32 GetNodeActivationCount(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Returns scratch value stored by given Decorator in this Session.
+	 *
+	 * @param Decorator     Decorator which stored the value.
+	 * @param Key           Name of the value.
+	 * @param DefaultValue  Returned if the value was not stored yet.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Session",
+		meta=(CustomTag="MounteaK2Getter"))
+	float GetDecoratorValue(const UMounteaDialogueDecoratorBase* Decorator, const FName Key, const float DefaultValue = 0.f) const;
+
+	/**
+	 * Stores scratch value of given Decorator, values are dropped once the dialogue ends.
+	 * ❔ Use instead of Decorator member variables, Decorators are shared by every Session running the Graph.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Session",
+		meta=(CustomTag="MounteaK2Setter"))
+	void SetDecoratorValue(const UMounteaDialogueDecoratorBase* Decorator, const FName Key, const float Value);
+
+	/**
+	 * Server-only. Recomputes connections this Session replicates to.
+	 * Those are connections of the Session Manager and participants, plus players around the active speaker
+	 * when Eavesdrop Radius is set. Pooled Session keeps its last audience, so the audience sees it end.
+	 */
+	void UpdateReplicationAudience();
+
+	/**
+	 * Streams in child Graphs of given Graph until the dialogue ends, runs on server and clients.
+	 * Calling it again for the same Graph does nothing.
+	 */
+	void PreloadChildGraphs(UMounteaDialogueGraph* Graph);
+
+	// Releases every child Graph preload requested by this Session.
+	void ReleaseChildGraphs();
+
+	/**
+	 * Server-only. Sends Node references of the current payload again,
+	 * used once a client reported its Graph does not match and needs GUID addressing.
+	 */
+	void ResendNodeReferences();
+
+	/**
+	 * Server-only. Sends the active Dialogue Row again,
+	 * used once a client reported it cannot resolve the row and needs it in full.
+	 */
+	void ResendActiveDialogueRow();
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	/**
+	 * Server-only. Starts accounting of a new dialogue, stats of the previous one are archived in the World Subsystem.
+	 */
+	void BeginSessionStats(const FGuid& SessionGUID, const UMounteaDialogueGraph* Graph);
+
+	FMounteaDialogueSessionStats& GetSessionStats()
+	{ return SessionStats; };
+
+	const FMounteaDialogueSessionStats& GetSessionStats() const
+	{ return SessionStats; };
+#endif
+
 	void SetRoleOverride(EDialogueParticipantType Role, const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant);
 	TScriptInterface<IMounteaDialogueParticipantInterface> GetRoleOverride(EDialogueParticipantType Role) const;
 
@@ -132,6 +236,16 @@ public:
 	 */
 	virtual FGuid GetConditionSessionGUID_Implementation() const override
 	{ return ContextPayload.SessionGUID; };
+
+	/**
+	 * Results are reused until the payload is written again or a Node is traversed.
+	 */
+	virtual FMounteaDialogueConditionCache* GetConditionCache(FMounteaDialogueConditionRevision& OutRevision) const override;
+
+	/**
+	 * Answers from the Session Traversed Path, or from participants before any Node was traversed.
+	 */
+	virtual int32 GetConditionTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const override;
 	// ~IMounteaDialogueConditionContextInterface
 
 private:
@@ -142,20 +256,73 @@ private:
 	 * Client path notifies only managers whose owners are locally controlled.
 	 */
 	void NotifyLocalManagers();
+
+	// Returns Session Manager if it is controlled by this client, null otherwise.
+	UMounteaDialogueManager* GetLocalSessionManager() const;
 	void AddTraversedNode(const UMounteaDialogueGraphNode* TraversedNode);
+	// Resolves Node indices and the Data Table row handle of the active Node, so clients can resolve them locally.
+	void ResolveCompactReferences(FMounteaDialogueContextPayload& Payload) const;
+	// Client only, asks the server to address Nodes of the active Graph by GUID.
+	void ReportNodeAddressingMismatch();
+	// Client only, asks the server to send rows of the active Data Table in full. Returns false if this client does not run the dialogue.
+	bool ReportUnresolvedDialogueRow();
+	/**
+	 * Client only. Returns true while the active Graph of the payload is streaming in.
+	 * Node GUIDs cannot be resolved until then, the payload is delivered once the Graph load finishes.
+	 * Also returns true if Node indices received meanwhile turn out not to match the Graph, GUIDs are requested then.
+	 */
+	bool AwaitActiveGraph();
+	void HandleGraphLoadFinished(const FGuid& GraphGUID, UMounteaDialogueGraph* Graph);
+	void StopAwaitingGraph();
 	bool IsSessionRequestValid(UMounteaDialogueManager* Manager, const FGuid& SessionGUID, const TCHAR* ActionName) const;
+	/**
+	 * Server only, Apply*Payload functions update ContextPayload in place instead of writing a new one.
+	 * Begin bumps ContextVersion and applies session, participants and row of the Context, Commit publishes the result.
+	 */
+	bool BeginContextPayloadEdit(const UMounteaDialogueContext* DialogueContext);
+	void CommitContextPayloadEdit();
+	// Shared tail of payload writes, marks the payload dirty and dispatches it.
+	void PublishContextPayload();
+	// Drops per dialogue state once the payload switches to another Session GUID.
+	void ResetSessionState();
 	void ApplyNodeSwitchPayload(const UMounteaDialogueContext* DialogueContext);
 	void ApplyAllowedChildrenPayload(const UMounteaDialogueContext* DialogueContext);
 	void ApplyRowStatePayload(const UMounteaDialogueContext* DialogueContext);
+	// Server only, replicates this Session only to connections included in the Audience Net Group.
+	void RegisterAudienceNetGroup();
+	void ClearReplicationAudience();
 
 	TWeakObjectPtr<UMounteaDialogueManager> AuthoritativeManager;
 	TMap<int32, TScriptInterface<IMounteaDialogueParticipantInterface>> RoleOverrides;
 	TArray<FDialogueTraversePath> SessionTraversedPath;
+	FMounteaDialogueTraversalIndex SessionTraversedPathIndex;
+	// Bumped whenever Session Traversed Path changes, part of the condition cache revision.
+	int32 TraversedPathRevision = 0;
+	mutable FMounteaDialogueConditionCache ConditionCache;
 	int32 LastDeliveredContextVersion = 0;
 	FGuid LastDeliveredSessionGUID;
 	FGuid PendingClientDispatchSessionGUID;
 	int32 PendingClientDispatchVersion = 0;
 	int32 LastPendingDispatchWarningVersion = 0;
 	bool bClientDispatchPending = false;
-	FTimerHandle PendingDispatchRetryTimer;
+	// Payload arrived before the Session Manager reference could be resolved.
+	bool bAwaitingSessionManager = false;
+	// Graph the Node addressing mismatch was already reported for.
+	FGuid ReportedAddressingMismatchGraphGUID;
+	// Data Table the unresolved Dialogue Row was already reported for.
+	TWeakObjectPtr<UDataTable> ReportedUnresolvedRowTable;
+	// Graphs this Session requested child Graph preloads for, released once the dialogue ends.
+	TArray<FGuid> PreloadedGraphGUIDs;
+	// Graph the client payload delivery waits for, see AwaitActiveGraph.
+	FGuid AwaitedGraphGUID;
+	FDelegateHandle GraphLoadFinishedHandle;
+	// Net Condition Group of this Session, none if the owner does not support per-connection conditions.
+	FName AudienceNetGroup;
+	TArray<TWeakObjectPtr<APlayerController>> AudienceControllers;
+	FTimerHandle AudienceRefreshTimer;
+	FMounteaDialogueSessionInstanceData InstanceData;
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	// Cost of the running, or last finished, dialogue.
+	FMounteaDialogueSessionStats SessionStats;
+#endif
 };
@@ -26,12 +26,25 @@ enum class EConditionEvaluationMode : uint8
 	Any		UMETA(DisplayName = "Any",	ToolTip = "At least one condition must pass for the edge to be traversable.")
 };
 
+/**
+ * Declares how results of a condition may be reused by the condition cache of its context.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueConditionCaching : uint8
+{
+	Never		UMETA(DisplayName = "Never",	ToolTip = "Evaluated every time. Required for conditions reading anything outside of the condition context, like inventory or world state."),
+	Context		UMETA(DisplayName = "Context",	ToolTip = "Result depends only on the condition context (participants, active participant, active Node and traversed path) and is reused until the context changes."),
+	Pure		UMETA(DisplayName = "Pure",		ToolTip = "Result depends only on properties of the condition and is evaluated once per context.")
+};
+
 /**
  * Mountea Dialogue Condition Base
  *
  * Abstract base for all edge conditions. Subclass in C++ or Blueprint to implement
  * custom traversal logic. Conditions are instanced (EditInlineNew) so each edge
  * owns its own instances.
+ *
+ * ❔ Set Caching in class defaults, so repeated refreshes of the same Node do not evaluate the condition again.
  */
 UCLASS(Blueprintable, BlueprintType, EditInlineNew,
 	ClassGroup=("Mountea|Dialogue"),
@@ -91,6 +104,12 @@ public:
 		meta=(CustomTag="MounteaK2Setter"))
 	void SetConditionGUID(const FGuid& NewGUID);
 
+	/**
+	 * Returns true if EvaluateCondition is not overridden in Blueprint,
+	 * so EvaluateCondition_Implementation can be called directly, without the Blueprint VM.
+	 */
+	bool HasNativeEvaluation() const;
+
 public:
 	
 	/** Name of the condition. Used for mapping from Dialoguer and to simplify display in UI. */
@@ -98,6 +117,14 @@ public:
 		meta=(NoResetToDefault))
 	FName ConditionName = NAME_None;
 
+	/**
+	 * Declares how results of this condition may be reused, set per condition class.
+	 * ❗ Never caching is the safe default, Context or Pure results are not refreshed by changes outside of the context.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Condition",
+		meta=(NoResetToDefault))
+	EMounteaDialogueConditionCaching Caching = EMounteaDialogueConditionCaching::Never;
+
 private:
 	
 	/** Stable per-instance GUID. Auto-generated on creation; overwritten on import with the Dialoguer id. */
@@ -150,3 +177,21 @@ struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueEdgeConditions
 		meta=(NoResetToDefault))
 	EConditionEvaluationMode Mode = EConditionEvaluationMode::All;
 };
+
+/**
+ * Single step of a compiled condition program.
+ * Steps of one Edge are ordered native first when all its Blueprint conditions are Pure,
+ * so Blueprint conditions are called only if native ones did not decide the result.
+ *
+ * @see UMounteaDialogueConditionsStatics::CompileConditionRules
+ */
+struct FMounteaDialogueConditionOp
+{
+	// Owned by the Edge, compiled Graph keeps the rules referencing it alive. Ops are rebuilt once objects get reinstanced.
+	TObjectPtr<UMounteaDialogueConditionBase> Condition = nullptr;
+
+	bool bNegate = false;
+
+	// Evaluated through EvaluateCondition_Implementation instead of the Blueprint VM.
+	bool bNative = false;
+};
@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "MounteaDialogueCompactTraversedPath.generated.h"
+
+class UMounteaDialogueGraph;
+
+/**
+ * Traversals of Nodes of a single Graph, addressed by stable Node index.
+ *
+ * @see UMounteaDialogueGraph::FindStableNodeIndex
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueGraphTraversal
+{
+	FGuid GraphGuid;
+
+	// Bit per stable Node index, set once the Node was traversed.
+	TBitArray<> TraversedNodes;
+
+	// Counts of traversed Nodes which were not traversed exactly once, by stable Node index.
+	TMap<int32, int32> TraverseCounts;
+
+	int32 GetTraverseCount(const int32 StableIndex) const;
+	void Add(const int32 StableIndex, const int32 TraverseCount);
+
+	bool operator==(const FMounteaDialogueGraphTraversal& Other) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FMounteaDialogueGraphTraversal& Traversal);
+};
+
+/**
+ * Compact form of a Traversed Path, used to save and replicate long dialogue histories.
+ *
+ * Every Graph stores one bit per Node, plus counts of Nodes traversed more than once,
+ * which serializes into a Graph GUID and a few bytes instead of 36 bytes per traversed Node.
+ * Conversion to and from the FDialogueTraversePath array is loss-free:
+ * * Entries whose Graph cannot be resolved when added are kept as they are.
+ * * Graphs which cannot be resolved when converting back are kept compact and reported.
+ *
+ * ❗ Relies on stable Node indices, which are assigned when the Graph is compiled.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueCompactTraversedPath
+{
+	GENERATED_BODY()
+
+public:
+
+	// Returns Graph of given GUID, null if it is not loaded.
+	using FGraphResolver = TFunctionRef<const UMounteaDialogueGraph*(const FGuid&)>;
+
+	/**
+	 * Adds traversals of given entry, merged with traversals of the same Node already stored.
+	 */
+	void Add(const FDialogueTraversePath& Entry, FGraphResolver FindGraph);
+
+	/**
+	 * Adds traversals of given entry, stable index already resolved by the caller.
+	 * Does not touch any Graph.
+	 *
+	 * @param Entry        Traversals to add.
+	 * @param StableIndex  Stable index of the entry Node, INDEX_NONE keeps the entry unresolved.
+	 */
+	void AddResolved(const FDialogueTraversePath& Entry, const int32 StableIndex);
+
+	void Append(TConstArrayView<FDialogueTraversePath> Path, FGraphResolver FindGraph);
+
+	/**
+	 * Appends all stored traversals to given Traversed Path.
+	 *
+	 * @return false if some Graph could not be resolved, its traversals are not part of the output.
+	 */
+	bool ToTraversedPath(TArray<FDialogueTraversePath>& OutPath, FGraphResolver FindGraph) const;
+
+	/**
+	 * Returns how many times given Node was traversed, read from the compact form directly.
+	 * Unlike the rebuilt array, answers for every Graph which is resolvable at the time of the call.
+	 */
+	int32 GetTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid, FGraphResolver FindGraph) const;
+
+	// Returns true if traversals of given Graph are stored in the compact form.
+	bool ContainsGraph(const FGuid& GraphGuid) const;
+
+	static FMounteaDialogueCompactTraversedPath FromTraversedPath(TConstArrayView<FDialogueTraversePath> Path, FGraphResolver FindGraph);
+
+	bool IsEmpty() const
+	{ return Graphs.IsEmpty() && UnresolvedEntries.IsEmpty(); };
+
+	void Reset();
+
+	bool Serialize(FArchive& Ar);
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	bool Identical(const FMounteaDialogueCompactTraversedPath* Other, uint32 PortFlags) const;
+
+private:
+
+	FMounteaDialogueGraphTraversal& FindOrAddGraph(const FGuid& GraphGuid);
+	const FMounteaDialogueGraphTraversal* FindGraphTraversal(const FGuid& GraphGuid) const;
+
+	TArray<FMounteaDialogueGraphTraversal> Graphs;
+
+	// Entries which could not be resolved to a stable Node index when added.
+	TArray<FDialogueTraversePath> UnresolvedEntries;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaDialogueCompactTraversedPath> : public TStructOpsTypeTraitsBase2<FMounteaDialogueCompactTraversedPath>
+{
+	enum
+	{
+		WithSerializer = true,
+		WithNetSerializer = true,
+		WithIdentical = true
+	};
+};
@@ -0,0 +1,203 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Conditions/MounteaDialogueConditionBase.h"
+
+#include "MounteaDialogueCompiledGraph.generated.h"
+
+class UDataTable;
+class UMounteaDialogueGraph;
+
+/**
+ * Coarse Node classification stored in the compiled graph.
+ * Lets traversal branch on Node kind without touching the Node UObject.
+ */
+UENUM()
+enum class EMounteaDialogueCompiledNodeType : uint8
+{
+	Generic,
+	Start,
+	Lead,
+	Answer,
+	Complete,
+	Delay,
+	OpenChildGraph,
+	ReturnToNode
+};
+
+/**
+ * Flattened, index based copy of the Dialogue Graph topology.
+ *
+ * Built from the Node/Edge UObjects when the Graph is saved or cooked (and explicitly after editor changes).
+ * Runtime only reads it, the columns are trusted as serialized.
+ * Node 'i' in every column matches 'UMounteaDialogueGraph::AllNodes[i]'.
+ *
+ * * Children are stored CSR style: children of Node 'i' are ChildIndices[ChildOffsets[i] .. ChildOffsets[i + 1]).
+ * * Every child slot is one Edge, its condition rules are ConditionRuleIndices[ConditionOffsets[slot] .. ConditionOffsets[slot + 1]).
+ *   Rules are stored as indices into the Edge rules, condition instances stay owned (and serialized) by the Edge only.
+ * * Per Node data (type, execution order, speech row) are stored as separate columns.
+ *
+ * ❗ Node and Edge UObjects are still the source of truth, this is a read only acceleration structure.
+ */
+USTRUCT()
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueCompiledGraph
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY()
+	TArray<FGuid> NodeGuids;
+
+	UPROPERTY()
+	TArray<EMounteaDialogueCompiledNodeType> NodeTypes;
+
+	UPROPERTY()
+	TArray<int32> ExecutionOrders;
+
+	// Index into SpeechTables, INDEX_NONE for Nodes without Dialogue data.
+	UPROPERTY()
+	TArray<int32> SpeechTableIndices;
+
+	UPROPERTY()
+	TArray<FName> SpeechRowNames;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UDataTable>> SpeechTables;
+
+	// NodeCount + 1 entries.
+	UPROPERTY()
+	TArray<int32> ChildOffsets;
+
+	UPROPERTY()
+	TArray<int32> ChildIndices;
+
+	// EdgeCount + 1 entries, one Edge per child slot.
+	UPROPERTY()
+	TArray<int32> ConditionOffsets;
+
+	UPROPERTY()
+	TArray<EConditionEvaluationMode> ConditionModes;
+
+	// Index of the rule within EdgeConditions.Rules of the Edge stored in the child slot.
+	UPROPERTY()
+	TArray<int32> ConditionRuleIndices;
+
+	// Shortest amount of child steps from the Node to any Open Child Graph Node, INDEX_NONE if none is reachable.
+	UPROPERTY()
+	TArray<int32> OpenChildGraphDistances;
+
+	// Compiled form of the condition rules, slot ranges match ConditionOffsets. Not serialized, rebuilt from the Edges after load.
+	TArray<FMounteaDialogueConditionOp> ConditionOps;
+
+	// Node index of the Graph Start Node.
+	UPROPERTY()
+	int32 StartNodeIndex = INDEX_NONE;
+
+	// Checksum of the Graph GUID and Node order, peers agreeing on it can address Nodes by index.
+	UPROPERTY()
+	uint32 NodeTableChecksum = 0;
+
+	// Checksum of the Nodes, children, Edge rules and speech rows the columns were compiled from.
+	UPROPERTY()
+	uint32 SourceChecksum = 0;
+
+public:
+
+	/**
+	 * Rebuilds all columns from the Graph Nodes and Edges.
+	 *
+	 * @param Graph Graph to compile.
+	 */
+	void Compile(const UMounteaDialogueGraph& Graph);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const
+	{ return NodeGuids.Num(); };
+
+	FORCEINLINE bool IsValidNodeIndex(const int32 NodeIndex) const
+	{ return NodeGuids.IsValidIndex(NodeIndex); };
+
+	/**
+	 * Returns true if the compiled data still match the Graph Nodes and Edges.
+	 * ❗ Walks the whole Graph, not meant to be called per traversal.
+	 */
+	bool IsUpToDate(const UMounteaDialogueGraph& Graph) const;
+
+	/**
+	 * Resolves condition rules of every child slot from the Graph Edges.
+	 * Called by Compile, and by the Graph once serialized columns are loaded.
+	 */
+	void CompileConditionOps(const UMounteaDialogueGraph& Graph);
+
+	// Returns true if any condition op points to one of the replaced objects.
+	bool ReferencesAnyCondition(const TMap<UObject*, UObject*>& ReplacedObjects) const;
+
+	// Registers reinstancing callbacks, called from module startup.
+	static void Startup();
+
+	static void Shutdown();
+
+	// Returns the first child slot of the Node, use with GetChildSlotEnd.
+	FORCEINLINE int32 GetChildSlotBegin(const int32 NodeIndex) const
+	{ return ChildOffsets[NodeIndex]; };
+
+	FORCEINLINE int32 GetChildSlotEnd(const int32 NodeIndex) const
+	{ return ChildOffsets[NodeIndex + 1]; };
+
+	FORCEINLINE TConstArrayView<int32> GetChildIndices(const int32 NodeIndex) const
+	{ return MakeArrayView(ChildIndices.GetData() + ChildOffsets[NodeIndex], ChildOffsets[NodeIndex + 1] - ChildOffsets[NodeIndex]); };
+
+	FORCEINLINE EConditionEvaluationMode GetSlotConditionMode(const int32 ChildSlot) const
+	{ return ConditionModes[ChildSlot]; };
+
+	// Returns the compiled condition program of the Edge stored in given child slot.
+	FORCEINLINE TConstArrayView<FMounteaDialogueConditionOp> GetSlotConditionOps(const int32 ChildSlot) const
+	{ return MakeArrayView(ConditionOps.GetData() + ConditionOffsets[ChildSlot], ConditionOffsets[ChildSlot + 1] - ConditionOffsets[ChildSlot]); };
+
+	FORCEINLINE int32 GetExecutionOrder(const int32 NodeIndex) const
+	{ return ExecutionOrders[NodeIndex]; };
+
+	FORCEINLINE EMounteaDialogueCompiledNodeType GetNodeType(const int32 NodeIndex) const
+	{ return NodeTypes[NodeIndex]; };
+
+	FORCEINLINE uint32 GetNodeTableChecksum() const
+	{ return NodeTableChecksum; };
+
+	FORCEINLINE FGuid GetNodeGuid(const int32 NodeIndex) const
+	{ return NodeGuids.IsValidIndex(NodeIndex) ? NodeGuids[NodeIndex] : FGuid(); };
+
+	FORCEINLINE int32 GetOpenChildGraphDistance(const int32 NodeIndex) const
+	{ return OpenChildGraphDistances.IsValidIndex(NodeIndex) ? OpenChildGraphDistances[NodeIndex] : INDEX_NONE; };
+
+	/**
+	 * Returns Dialogue Data Table and Row Name of the Node.
+	 *
+	 * @return True if the Node has valid speech row handle.
+	 */
+	bool GetSpeechRowHandle(const int32 NodeIndex, UDataTable*& OutTable, FName& OutRowName) const;
+
+private:
+
+	void CompileOpenChildGraphDistances();
+
+	/**
+	 * Recompiles condition ops of Graphs pointing to replaced objects, Blueprint compilation replaces condition instances and classes.
+	 * ❔ Editor only, runs on the game thread while reinstancing, so no Session evaluates the ops meanwhile.
+	 */
+	static void RecompileConditionOps(const TMap<UObject*, UObject*>& ReplacedObjects);
+
+	static FDelegateHandle ObjectsReplacedHandle;
+};
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UMounteaDialogueConditionBase;
+enum class EMounteaDialogueConditionCaching : uint8;
+
+/**
+ * Revision of the state a condition context exposes to conditions.
+ * Change of either part drops results of context dependent conditions.
+ */
+struct FMounteaDialogueConditionRevision
+{
+	int32 ContextVersion = INDEX_NONE;
+	int32 TraversedPathRevision = INDEX_NONE;
+
+	bool operator==(const FMounteaDialogueConditionRevision& Other) const
+	{ return ContextVersion == Other.ContextVersion && TraversedPathRevision == Other.TraversedPathRevision; };
+
+	bool operator!=(const FMounteaDialogueConditionRevision& Other) const
+	{ return !(*this == Other); };
+};
+
+/**
+ * Results of condition evaluations, owned by a condition context.
+ *
+ * * Pure conditions are evaluated once for the lifetime of the cache.
+ * * Context dependent conditions are reused until the revision of the context changes.
+ * * Conditions which are never cached are not stored at all.
+ *
+ * Results are stored before negation and keyed by the condition instance, conditions are instanced per edge rule.
+ *
+ * ❗ Game thread only.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueConditionCache
+{
+public:
+
+	/**
+	 * Returns cached result of given condition, null if the condition has to be evaluated.
+	 *
+	 * @param Condition  Evaluated condition.
+	 * @param Caching    Caching declared by the condition.
+	 * @param Revision   Current revision of the owning context.
+	 */
+	const bool* Find(const UMounteaDialogueConditionBase* Condition, const EMounteaDialogueConditionCaching Caching, const FMounteaDialogueConditionRevision& Revision);
+
+	// Stores result of given condition for the revision passed to the last Find.
+	void Add(const UMounteaDialogueConditionBase* Condition, const EMounteaDialogueConditionCaching Caching, const bool bResult);
+
+	void Reset();
+
+private:
+
+	FMounteaDialogueConditionRevision CachedRevision;
+	TMap<TObjectKey<UMounteaDialogueConditionBase>, bool> ContextResults;
+	TMap<TObjectKey<UMounteaDialogueConditionBase>, bool> PureResults;
+};
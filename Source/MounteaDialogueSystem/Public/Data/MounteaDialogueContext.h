@@ -13,6 +13,8 @@
 
 #include "CoreMinimal.h"
 #include "MounteaDialogueGraphDataTypes.h"
+#include "Data/MounteaDialogueConditionCache.h"
+#include "Data/MounteaDialogueTraversalIndex.h"
 #include "Interfaces/Core/MounteaDialogueConditionContextInterface.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "UObject/Object.h"
@@ -153,6 +155,12 @@ public:
 		return AllowedChildNodes; 
 	};
 
+	// Native, non-copying counterpart of GetChildrenNodes.
+	TConstArrayView<TObjectPtr<UMounteaDialogueGraphNode>> GetChildrenNodesView() const
+	{ 
+		return AllowedChildNodes; 
+	};
+
 	FDataTableRowHandle GetActiveDataTable() const
 	{ 
 		return ActiveDialogueTableHandle; 
@@ -164,7 +172,7 @@ public:
 	 * 
 	 * @return Active Dialogue Row if any 
 	 */
-	FDialogueRow GetActiveDialogueRow() const
+	const FDialogueRow& GetActiveDialogueRow() const
 	{ 
 		return ActiveDialogueRow; 
 	};
@@ -189,9 +197,10 @@ public:
 		return TraversedPath; 
 	};
 	
-	virtual void SetDialogueContext(UMounteaDialogueGraphNode* NewActiveNode, TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes);
+	// Allowed children are copied into already allocated memory, pass any array or inline buffer.
+	virtual void SetDialogueContext(UMounteaDialogueGraphNode* NewActiveNode, TConstArrayView<UMounteaDialogueGraphNode*> NewAllowedChildNodes);
 	virtual void UpdateActiveDialogueNode(UMounteaDialogueGraphNode* NewActiveNode);
-	virtual void UpdateAllowedChildrenNodes(const TArray<UMounteaDialogueGraphNode*>& NewNodes);
+	virtual void UpdateAllowedChildrenNodes(TConstArrayView<UMounteaDialogueGraphNode*> NewNodes);
 	virtual void UpdateActiveDialogueTable(const FDataTableRowHandle& NewHandle);
 	virtual void UpdateActiveDialogueRow(const FDialogueRow& NewActiveRow);
 	virtual void UpdateActiveDialogueRowDataIndex(int32 NewIndex);
@@ -203,6 +212,13 @@ public:
 	virtual bool RemoveDialogueParticipants(const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants);
 	virtual bool RemoveDialogueParticipant(const TScriptInterface<IMounteaDialogueParticipantInterface>& NewParticipant);
 	virtual void ClearDialogueParticipants();
+
+	/**
+	 * Invalidates cached condition results.
+	 * ❗ Call after writing participants, active participant, active Node or traversed path directly.
+	 */
+	void MarkConditionStateChanged()
+	{ ConditionRevision++; };
 		
 	/**
 	 * Sets the dialogue context.
@@ -279,4 +295,15 @@ public:
 	{ 
 		return SessionGUID; 
 	};
+	virtual FMounteaDialogueConditionCache* GetConditionCache(FMounteaDialogueConditionRevision& OutRevision) const override;
+	virtual int32 GetConditionTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const override
+	{ return TraversedPathIndex.GetTraverseCount(TraversedPath, NodeGuid, GraphGuid); };
+
+private:
+
+	// Bumped by every change condition results may depend on.
+	int32 ConditionRevision = 0;
+	mutable FMounteaDialogueConditionCache ConditionCache;
+	// Lookup of Traversed Path entries, rebuilt once Traversed Path is written directly.
+	FMounteaDialogueTraversalIndex TraversedPathIndex;
 };
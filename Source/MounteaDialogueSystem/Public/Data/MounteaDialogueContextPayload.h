@@ -14,21 +14,44 @@
 #include "CoreMinimal.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
 #include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "Misc/NetworkGuid.h"
 
 #include "MounteaDialogueContextPayload.generated.h"
 
+class UDataTable;
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+struct FNetDeltaSerializeInfo;
+
 /**
  * FMounteaDialogueContextPayload is the authoritative, network-replicated state of an active
  * dialogue session. It lives as a UPROPERTY on UMounteaDialogueSession (attached to AGameState),
  * giving it a stable replication path to all clients.
  *
  * The server is the sole mutator. Every mutation increments ContextVersion.
- * Clients receive the full struct via OnRep and rebuild their local read-only
+ * Clients receive it via OnRep and rebuild their local read-only
  * UMounteaDialogueContext view from it.
  *
+ * Property replication is delta compressed against the last state acknowledged by the connection.
+ * Each field group remembers the ContextVersion it last changed in, only groups stamped after
+ * the acknowledged state are sent, prefixed with a dirty field mask.
+ *
  * @see UMounteaDialogueSession
  * @see UMounteaDialogueContext
  */
+/**
+ * Received field group whose object references did not resolve yet, client only.
+ * Keeps the received bits, so the field can be read again once the references map.
+ */
+struct FMounteaDialoguePayloadUnmappedField
+{
+	int32 Field = INDEX_NONE;
+	TSet<FNetworkGUID> UnmappedGUIDs;
+	TSet<FNetworkGUID> MappedDynamicGUIDs;
+	TArray<uint8> Buffer;
+	int64 NumBits = 0;
+};
+
 USTRUCT(BlueprintType)
 struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueContextPayload
 {
@@ -88,6 +111,16 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category="Context")
 	FDialogueRow ActiveDialogueRow;
 
+	/**
+	 * Data Table ActiveDialogueRow was read from, null if the row does not match any Data Table row.
+	 * While valid, only this handle is replicated and clients resolve the row from their own row cache.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Context")
+	TObjectPtr<UDataTable> ActiveRowTable = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category="Context")
+	FName ActiveRowName = NAME_None;
+
 	/**
 	 * Index into ActiveDialogueRow.RowData for the line currently being played.
 	 * Advances as each line of the row completes.
@@ -102,10 +135,99 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category="Context")
 	int32 ContextVersion = 0;
 
+	// Amount of field groups tracked by delta serialization, ContextVersion is always sent.
+	static constexpr int32 DeltaFieldCount = 9;
+
+	/**
+	 * ContextVersion in which each field group last changed, server only.
+	 * ❗ Versions only grow, so a field changed and reverted since the acknowledged state is still sent.
+	 */
+	int32 FieldVersions[DeltaFieldCount] = {};
+
+	/**
+	 * Compact Node addressing, resolved on the server against the active Graph.
+	 * While NodeTableChecksum is not zero, Node references which belong to the active Graph
+	 * are sent as packed Node indices, GUIDs remain the source of truth.
+	 */
+	uint32 NodeTableChecksum = 0;
+	int32 ActiveNodeIndex = INDEX_NONE;
+	int32 PreviousNodeIndex = INDEX_NONE;
+	TArray<int32> AllowedChildNodeIndices;
+
+	// Client only, set when received Node indices could not be resolved because the local Graph differs.
+	bool bNodeAddressingMismatch = false;
+
+	// Client only, set when received Node indices wait for the active Graph to stream in, see ResolveDeferredNodeAddressing.
+	bool bNodeAddressingDeferred = false;
+
+	/**
+	 * Client only, field groups holding object references which are not mapped yet, participants and row assets
+	 * of Actors not relevant yet for instance. Fields are read again as soon as their references map.
+	 */
+	TArray<FMounteaDialoguePayloadUnmappedField> UnmappedFields;
+
+	// Client only, set when late mapped references changed the payload without a new ContextVersion.
+	bool bReferencesRemapped = false;
+
+	// Client only, set when the received row handle is missing from the local row cache.
+	bool bActiveRowUnresolved = false;
+
 public:
 
+	// Full serialization, used outside of property replication.
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
+	/**
+	 * Property replication path, writes only field groups changed since the acknowledged state.
+	 * Also tracks object references clients could not map yet, so they are resolved once the objects arrive.
+	 */
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+	/**
+	 * Stamps every field group which differs from Previous with current ContextVersion.
+	 * Unchanged Dialogue Row keeps the RowGUID of Previous, so clients keep matching it.
+	 * Call on the server after ContextVersion was assigned.
+	 */
+	void StampChangedFields(const FMounteaDialogueContextPayload& Previous);
+
+	/**
+	 * In place counterparts of StampChangedFields, server only.
+	 * Each setter changes and stamps its field group with current ContextVersion only if the value differs,
+	 * so ContextVersion must be assigned before.
+	 */
+	void SetSessionGUID(const FGuid& NewSessionGUID);
+	void SetActiveNode(const FGuid& NewActiveNodeGUID, const FGuid& NewActiveGraphGUID);
+	void SetPreviousNode(const FGuid& NewPreviousNodeGUID);
+	void SetAllowedChildNodes(TConstArrayView<TObjectPtr<UMounteaDialogueGraphNode>> ChildNodes);
+	void SetParticipants(const TScriptInterface<IMounteaDialogueParticipantInterface>& NewActiveParticipant,
+		const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants);
+	// Unchanged row keeps its RowGUID, so clients holding the row still match it.
+	void SetActiveRow(const FDialogueRow& NewRow, const int32 NewRowDataIndex);
+
+	/**
+	 * Resolves compact Node addressing against given Graph, null disables it.
+	 */
+	void UpdateNodeAddressing(UMounteaDialogueGraph* Graph);
+
+	// Forces Node references to be sent again, stamping them with current ContextVersion.
+	void StampNodeReferenceFields();
+
+	/**
+	 * Client only. Resolves Node indices received while the active Graph was not resident.
+	 * Returns false and flags a mismatch if the Graph differs from the server one.
+	 */
+	bool ResolveDeferredNodeAddressing(UMounteaDialogueGraph* Graph);
+
+	// Forces ActiveDialogueRow to be sent again, stamping it with current ContextVersion.
+	void StampActiveRowField();
+
+	/**
+	 * Sets the Data Table handle of ActiveDialogueRow.
+	 * Handle is kept only if the cached Data Table row matches ActiveDialogueRow, otherwise the full row keeps replicating.
+	 * Changed handle stamps ActiveDialogueRow with current ContextVersion.
+	 */
+	void UpdateActiveRowHandle(UDataTable* Table, const FName& RowName);
+
 	bool IsValid() const
 	{
 		return SessionGUID.IsValid();
@@ -121,8 +243,16 @@ public:
 		ActiveDialogueParticipant = nullptr;
 		DialogueParticipants.Empty();
 		ActiveDialogueRow = FDialogueRow();
+		ActiveRowTable = nullptr;
+		ActiveRowName = NAME_None;
 		ActiveDialogueRowDataIndex = 0;
 		ContextVersion = 0;
+		UpdateNodeAddressing(nullptr);
+		bNodeAddressingMismatch = false;
+		bNodeAddressingDeferred = false;
+		UnmappedFields.Empty();
+		bReferencesRemapped = false;
+		bActiveRowUnresolved = false;
 	}
 };
 
@@ -131,6 +261,7 @@ struct TStructOpsTypeTraits<FMounteaDialogueContextPayload> : public TStructOpsT
 {
 	enum
 	{
-		WithNetSerializer = true
+		WithNetSerializer = true,
+		WithNetDeltaSerializer = true
 	};
 };
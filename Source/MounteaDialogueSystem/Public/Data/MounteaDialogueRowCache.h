@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UDataTable;
+struct FDialogueRow;
+
+/**
+ * Process wide cache of Dialogue Rows, keyed by Data Table and Row Name.
+ *
+ * Rows are copied out of the Data Table once and then shared as immutable references,
+ * so traversal and UI code can read the same row repeatedly without copying it.
+ *
+ * * Cached rows of a table are dropped when the table broadcasts OnDataTableChanged.
+ * * Rows of garbage collected tables are dropped after each garbage collection.
+ * * Every cached row keeps durations of its Row Data, aligned with 'FDialogueRow::RowData'.
+ *   Durations are recomputed only once the duration coefficient or the culture changes.
+ *
+ * ❗ Game thread only.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueRowCache
+{
+public:
+
+	/**
+	 * Returns shared, immutable copy of the Dialogue Row.
+	 *
+	 * @param Table    Data Table with FDialogueRow based rows.
+	 * @param RowName  Name of the row to find.
+	 * @return Cached row, null if the table or row is not valid.
+	 */
+	static TSharedPtr<const FDialogueRow> FindRow(const UDataTable* Table, const FName& RowName);
+
+	// Shared 'FDialogueRow::Invalid()' instance, returned where a row reference is required.
+	static TSharedRef<const FDialogueRow> GetInvalidRow();
+
+	// Shared default constructed row, returned for Nodes without speech data.
+	static TSharedRef<const FDialogueRow> GetEmptyRow();
+
+	/**
+	 * Returns precomputed duration of a single Row Data.
+	 *
+	 * @param Table         Data Table the row is stored in.
+	 * @param RowName       Name of the row.
+	 * @param RowDataIndex  Index into 'FDialogueRow::RowData'.
+	 * @param RowDataGUID   GUID of the Row Data the caller holds, used to verify the cached row still matches it.
+	 * @param OutDuration   Duration in seconds.
+	 * @return True if the duration was found.
+	 */
+	static bool FindRowDuration(const UDataTable* Table, const FName& RowName, const int32 RowDataIndex, const FGuid& RowDataGUID, float& OutDuration);
+
+	/**
+	 * Returns Duration Coefficient from Dialogue Configuration.
+	 * Value is cached until InvalidateRowDurations is called.
+	 */
+	static float GetDurationCoefficient();
+
+	// Drops every cached row of given table.
+	static void InvalidateTable(const UDataTable* Table);
+
+	// Marks all precomputed durations outdated, call when the duration coefficient changes.
+	static void InvalidateRowDurations();
+
+	// Drops every cached row.
+	static void Reset();
+
+	// Registers garbage collection cleanup, called from module startup.
+	static void Startup();
+
+	static void Shutdown();
+
+private:
+
+	struct FCachedRow
+	{
+		explicit FCachedRow(const TSharedRef<const FDialogueRow>& InRow)
+			: Row(InRow)
+		{}
+
+		TSharedRef<const FDialogueRow> Row;
+
+		// One entry per 'FDialogueRow::RowData' element.
+		TArray<float> RowDurations;
+
+		// Value of DurationsSerial the durations were computed for.
+		uint32 RowDurationsSerial = 0;
+	};
+
+	struct FCachedTable
+	{
+		TWeakObjectPtr<UDataTable> Table;
+		TMap<FName, FCachedRow> Rows;
+		FDelegateHandle ChangedHandle;
+	};
+
+	static TMap<TObjectKey<UDataTable>, FCachedTable>& GetCachedTables();
+
+	static FCachedRow* FindOrAddCachedRow(const UDataTable* Table, const FName& RowName);
+
+	static void UpdateRowDurations(FCachedRow& CachedRow);
+
+	static void ReleaseCachedTable(FCachedTable& CachedTable);
+
+	static void PurgeCollectedTables();
+
+	static FDelegateHandle PostGarbageCollectHandle;
+
+	static FDelegateHandle CultureChangedHandle;
+
+	// Bumped whenever durations have to be recomputed, starts at 1 so fresh rows are always outdated.
+	static uint32 DurationsSerial;
+
+	// Negative until resolved from settings.
+	static float CachedDurationCoefficient;
+};
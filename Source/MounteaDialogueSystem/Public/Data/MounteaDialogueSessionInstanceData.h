@@ -0,0 +1,91 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueTimingWheel.h"
+
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+class UWorld;
+
+/**
+ * Runtime state of a single Node within one Dialogue Session.
+ */
+struct FMounteaDialogueNodeInstanceData
+{
+	// Timer of the Delay or Return To Node, invalid unless the Node is waiting.
+	FMounteaDialogueTimerHandle DelayTimer;
+
+	// How many times the Node became active in the Session.
+	int32 ActivationCount = 0;
+};
+
+/**
+ * Per Session block of mutable runtime state, so Graph assets can stay shared between Sessions.
+ *
+ * * Node data of every Graph the Session touches is stored in one array, a Graph gets a contiguous range
+ *   the first time one of its Nodes is accessed and Node 'i' lives at range start + 'i'.
+ * * Decorator scratch values are keyed by Decorator GUID.
+ * * Graph Decorators are bound once per Session and Graph, Participants never touch the shared Graph.
+ * * Reset keeps allocations, so pooled Sessions reuse their memory for the next dialogue.
+ *
+ * ❗ Game thread only.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionInstanceData
+{
+public:
+
+	/**
+	 * Returns data of given Node, allocating the range of its Graph if needed.
+	 *
+	 * @return Node data, null if the Node is not part of a valid Graph.
+	 */
+	FMounteaDialogueNodeInstanceData* FindOrAddNodeData(const UMounteaDialogueGraphNode* Node);
+
+	// Returns data of given Node, null if the Session has not touched it yet.
+	const FMounteaDialogueNodeInstanceData* FindNodeData(const UMounteaDialogueGraphNode* Node) const;
+
+	float GetDecoratorValue(const FGuid& DecoratorGUID, const FName& Key, const float DefaultValue) const;
+
+	void SetDecoratorValue(const FGuid& DecoratorGUID, const FName& Key, const float Value);
+
+	/**
+	 * Marks Decorators of given Graph as bound to this Session.
+	 *
+	 * @return True the first time the Graph is marked, false if it was bound already or is invalid.
+	 */
+	bool MarkGraphDecoratorsBound(const UMounteaDialogueGraph* Graph);
+
+	/**
+	 * Clears running timers and drops all state, keeping allocated memory.
+	 *
+	 * @param World  World the timers were started in, might be null during teardown.
+	 */
+	void Reset(UWorld* World);
+
+private:
+
+	int32 FindNodeSlot(const UMounteaDialogueGraphNode* Node, const UMounteaDialogueGraph*& OutGraph) const;
+
+private:
+
+	TArray<FMounteaDialogueNodeInstanceData> NodeData;
+
+	// First NodeData slot of each Graph, keyed by Graph GUID.
+	TMap<FGuid, int32> GraphOffsets;
+
+	TMap<FGuid, TMap<FName, float>> DecoratorValues;
+
+	// Graph GUIDs whose Graph and Graph Scope Decorators were initialized for this Session.
+	TSet<FGuid> BoundGraphs;
+};
@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Session accounting is compiled out of shipping builds, same as the dialogue console commands.
+#define MOUNTEA_DIALOGUE_WITH_SESSION_STATS (!UE_BUILD_SHIPPING)
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+
+/**
+ * Server cost of a single dialogue, accumulated by the Session running it.
+ *
+ * * Payload bytes are counted when delta replication writes the Context Payload, summed over connections.
+ * * RPCs are counted by function name, outgoing RPCs with their serialized size.
+ * * Condition evaluations and handler time are attributed to the Session whose handler is running,
+ *   see FMounteaDialogueSessionStatsScope.
+ *
+ * ❗ Game thread only.
+ *
+ * @see UMounteaDialogueWorldSubsystem::ReportSessionStats
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionStats
+{
+	struct FCounter
+	{
+		int32 Count = 0;
+		int64 Bytes = 0;
+		uint64 Cycles = 0;
+	};
+
+	FGuid SessionGUID;
+	FString GraphName;
+	double StartSeconds = 0.0;
+	// Zero while the dialogue is running.
+	double EndSeconds = 0.0;
+
+	int32 PayloadWrites = 0;
+	// Delta replication writes of the Context Payload, Count is sends and Bytes their size.
+	FCounter PayloadReplication;
+	int32 ConditionEvaluations = 0;
+	// Traversed path entries saved to participants once the dialogue finished.
+	int32 TraversedPathEntries = 0;
+
+	TMap<FName, FCounter> RPCs;
+	TMap<FName, FCounter> Handlers;
+
+	// Starts accounting of a new dialogue.
+	void Begin(const FGuid& InSessionGUID, const FString& InGraphName);
+
+	bool IsValid() const
+	{ return SessionGUID.IsValid(); };
+
+	void RecordRPC(const FName& Name, const int64 Bytes = 0);
+
+	double GetDurationSeconds() const;
+
+	// Sum of time spent in all handlers.
+	double GetHandlerMilliseconds() const;
+
+	// Header and rows of the CSV dump, one row per counter.
+	static FString GetCsvHeader();
+	void AppendCsvRows(FString& OutCsv) const;
+
+	FString ToString() const;
+
+	// Stats of the Session whose handler is running, null outside of handlers.
+	static FMounteaDialogueSessionStats* GetActive()
+	{ return Active; };
+
+private:
+
+	friend struct FMounteaDialogueSessionStatsScope;
+
+	static FMounteaDialogueSessionStats* Active;
+};
+
+/**
+ * Measures time spent in a Session handler and makes its stats active for the duration of the scope.
+ * Nested scopes are measured separately, outer handlers include time of the inner ones.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionStatsScope
+{
+	FMounteaDialogueSessionStatsScope(FMounteaDialogueSessionStats& InStats, const FName& InHandlerName);
+	~FMounteaDialogueSessionStatsScope();
+
+	UE_NONCOPYABLE(FMounteaDialogueSessionStatsScope);
+
+private:
+
+	FMounteaDialogueSessionStats& Stats;
+	FMounteaDialogueSessionStats* PreviousActive = nullptr;
+	FName HandlerName;
+	uint64 StartCycles = 0;
+};
+
+#define MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(Stats, Name) \
+	static const FName PREPROCESSOR_JOIN(sessionStatsName_, __LINE__)(Name); \
+	FMounteaDialogueSessionStatsScope PREPROCESSOR_JOIN(sessionStatsScope_, __LINE__)(Stats, PREPROCESSOR_JOIN(sessionStatsName_, __LINE__))
+
+#define MOUNTEA_DIALOGUE_SESSION_STATS_RPC(Stats, Name, Bytes) \
+	{ static const FName rpcStatsName(Name); (Stats).RecordRPC(rpcStatsName, Bytes); }
+
+#define MOUNTEA_DIALOGUE_SESSION_STATS_CONDITION() \
+	if (FMounteaDialogueSessionStats* activeSessionStats = FMounteaDialogueSessionStats::GetActive()) \
+		activeSessionStats->ConditionEvaluations++
+
+#else
+
+#define MOUNTEA_DIALOGUE_SESSION_STATS_SCOPE(Stats, Name)
+#define MOUNTEA_DIALOGUE_SESSION_STATS_RPC(Stats, Name, Bytes)
+#define MOUNTEA_DIALOGUE_SESSION_STATS_CONDITION()
+
+#endif
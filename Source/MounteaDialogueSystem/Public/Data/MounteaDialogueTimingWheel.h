@@ -0,0 +1,161 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TimerManager.h"
+#include "MounteaDialogueTimingWheel.generated.h"
+
+/**
+ * Handle of a timer scheduled on FMounteaDialogueTimingWheel.
+ * Stays valid until the timer is cleared, a fired timer is reported as inactive.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueTimerHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const
+	{ return Generation != 0; };
+
+	void Invalidate()
+	{
+		Index = INDEX_NONE;
+		Generation = 0;
+	}
+
+	bool operator==(const FMounteaDialogueTimerHandle& Other) const
+	{ return Index == Other.Index && Generation == Other.Generation; };
+
+private:
+
+	friend class FMounteaDialogueTimingWheel;
+
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
+/**
+ * Hierarchical timing wheel for dialogue timers, row durations, Delay Nodes and the typewriter effect.
+ *
+ * * Time advances in fixed steps of TickSeconds, a timer fires on the first Advance reaching its step.
+ * * Four levels of 64 slots, each level covers 64 times the range of the previous one.
+ *   Timers are linked into slots, so scheduling and clearing are O(1) and do not allocate once entries are pooled.
+ * * Timers expiring within one Advance fire together, ordered by expiration step and then by scheduling order.
+ * * The wheel only moves with Advance, pause and time dilation are applied by its owner.
+ *
+ * ❗ Game thread only.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueTimingWheel
+{
+public:
+
+	FMounteaDialogueTimingWheel();
+
+	/**
+	 * Schedules a one shot timer.
+	 *
+	 * @param Delegate  Called once the timer expires.
+	 * @param Delay     Seconds until expiration, zero or less fires on the next step.
+	 * @return Handle of the scheduled timer.
+	 */
+	FMounteaDialogueTimerHandle SetTimer(const FTimerDelegate& Delegate, const float Delay);
+
+	// Cancels the timer if it did not fire yet and invalidates the handle.
+	void ClearTimer(FMounteaDialogueTimerHandle& Handle);
+
+	bool IsTimerActive(const FMounteaDialogueTimerHandle& Handle) const;
+
+	// Returns seconds since the timer was scheduled, -1 if it is not active.
+	float GetTimerElapsed(const FMounteaDialogueTimerHandle& Handle) const;
+
+	// Returns seconds until the timer expires, -1 if it is not active.
+	float GetTimerRemaining(const FMounteaDialogueTimerHandle& Handle) const;
+
+	/**
+	 * Moves the wheel forward and fires every timer expired on the way.
+	 *
+	 * @param DeltaSeconds  Game time passed since the last Advance.
+	 */
+	void Advance(const float DeltaSeconds);
+
+	// Returns number of timers waiting to fire.
+	int32 Num() const
+	{ return ScheduledCount; };
+
+	// Drops all timers without firing them.
+	void Reset();
+
+	// Length of a single wheel step in seconds.
+	static constexpr double TickSeconds = 0.01;
+
+private:
+
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotCount = 1 << SlotBits;
+	static constexpr int32 SlotMask = SlotCount - 1;
+	static constexpr int32 LevelCount = 4;
+	static constexpr uint64 MaxTicks = (1ull << (SlotBits * LevelCount)) - 1;
+
+	enum class EEntryState : uint8
+	{
+		Free,
+		Scheduled,
+		Expired
+	};
+
+	struct FEntry
+	{
+		FTimerDelegate Delegate;
+		uint64 ExpireTick = 0;
+		uint64 Sequence = 0;
+		double StartSeconds = 0.0;
+		float Duration = 0.f;
+		uint32 Generation = 1;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Slot = INDEX_NONE;
+		EEntryState State = EEntryState::Free;
+	};
+
+	// Expired timer waiting in the batch, generation catches timers cleared by earlier callbacks.
+	struct FExpiredEntry
+	{
+		int32 Index;
+		uint32 Generation;
+	};
+
+	const FEntry* FindEntry(const FMounteaDialogueTimerHandle& Handle) const;
+	void LinkEntry(const int32 EntryIndex);
+	void UnlinkEntry(const int32 EntryIndex);
+	void FreeEntry(const int32 EntryIndex);
+	// Moves timers of given higher level slot into lower levels.
+	void CascadeSlot(const int32 Level, const int32 SlotIndex);
+	// Advances one step, collecting expired timers into ExpiredBatch.
+	void StepTick();
+
+private:
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TArray<FExpiredEntry> ExpiredBatch;
+
+	// First entry of each slot, level after level.
+	int32 SlotHeads[LevelCount * SlotCount];
+
+	uint64 CurrentTick = 0;
+	uint64 NextSequence = 0;
+	double ElapsedSeconds = 0.0;
+	int32 ScheduledCount = 0;
+	bool bFiring = false;
+};
@@ -0,0 +1,55 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+
+/**
+ * Hash index over a Traversed Path array, keyed by Node and Graph GUIDs.
+ * The array stays the storage, so Blueprints, replication and save games keep working with it,
+ * while native lookups and additions no longer scan the whole history.
+ *
+ * The index is rebuilt lazily once it does not match the array, like after the array was emptied, loaded or replicated.
+ * ❗ Writes which keep the size of the array must call Reset.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueTraversalIndex
+{
+public:
+
+	/**
+	 * Returns entry of given Node in the path, null if the Node was not traversed.
+	 */
+	const FDialogueTraversePath* Find(const TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid) const;
+
+	int32 GetTraverseCount(const TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid) const
+	{
+		const FDialogueTraversePath* foundEntry = Find(Path, NodeGuid, GraphGuid);
+		return foundEntry ? foundEntry->TraverseCount : 0;
+	};
+
+	/**
+	 * Adds traversals of given Node to the path, merged into an existing entry of the same Node.
+	 */
+	void Add(TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid, const int32 TraverseCount = 1);
+
+	void Reset()
+	{ EntryIndices.Reset(); };
+
+private:
+
+	int32 FindIndex(const TArray<FDialogueTraversePath>& Path, const FGuid& NodeGuid, const FGuid& GraphGuid) const;
+	void Validate(const TArray<FDialogueTraversePath>& Path) const;
+
+	// Node and Graph GUID to position in the indexed array.
+	mutable TMap<TPair<FGuid, FGuid>, int32> EntryIndices;
+};
@@ -27,9 +27,30 @@ enum class EDialogueClientPredictionType : uint8
 	Close
 };
 
+/**
+ * Wire identifier of a widget command, sent instead of the command string.
+ * Mirrors MounteaDialogueWidgetCommands, new commands must be appended before Custom.
+ */
+UENUM()
+enum class EMounteaDialogueUICommand : uint8
+{
+	None,
+	CreateDialogueWidget,
+	CloseDialogueWidget,
+	ShowDialogueRow,
+	UpdateDialogueRow,
+	HideDialogueRow,
+	AddDialogueOptions,
+	RemoveDialogueOptions,
+	ShowSkipUI,
+	HideSkipUI,
+	// Project specific command, sent as a string
+	Custom
+};
+
 /**
  * Version-stamped UI command delivered from the server Manager to the owning client
- * via Client_DispatchUISignal RPC.
+ * via Client_DispatchUISignalBatch or Client_DispatchUISignal RPC.
  *
  * The receiving UMounteaDialogueParticipantUserInterfaceComponent queues signals whose
  * RequiredContextVersion has not yet been satisfied and drains them in ascending version
@@ -76,3 +97,46 @@ struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueUISignal
 		Category="Mountea|Dialogue|UI")
 	bool bForceReconcile = false;
 };
+
+/**
+ * UI signals queued by the server Manager within a single frame,
+ * delivered to the owning client by one Client_DispatchUISignalBatch RPC.
+ *
+ * Known commands are sent as EMounteaDialogueUICommand, SessionGUID only when it changes between signals.
+ *
+ * @see UMounteaDialogueManager::QueueUISignal
+ */
+USTRUCT()
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueUISignalBatch
+{
+	GENERATED_BODY()
+
+	// Signals in the order they were queued.
+	UPROPERTY()
+	TArray<FMounteaDialogueUISignal> Signals;
+
+	/**
+	 * Appends given signal, signal equal to the last queued one is dropped.
+	 * ❗ Equal signals separated by others are kept, Show-Hide-Show must not collapse into Show-Hide.
+	 *
+	 * @return true if the signal was added.
+	 */
+	bool Add(const FMounteaDialogueUISignal& Signal);
+
+	bool IsEmpty() const
+	{ return Signals.IsEmpty(); };
+
+	void Reset()
+	{ Signals.Reset(); };
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaDialogueUISignalBatch> : public TStructOpsTypeTraitsBase2<FMounteaDialogueUISignalBatch>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
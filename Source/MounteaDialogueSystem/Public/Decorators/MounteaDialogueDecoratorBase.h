@@ -319,4 +319,7 @@ public:
 	
 };
 
+// Decorator list used by native traversal, Nodes rarely have more than a few Decorators so it stays on the stack.
+using FMounteaDialogueDecoratorBuffer = TArray<FMounteaDialogueDecorator, TInlineAllocator<8>>;
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -79,4 +79,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mountea|Dialogue|Edge",
 		meta=(CustomTag="MounteaK2Getter"))
 	FMounteaDialogueEdgeConditions GetEdgeConditions() const;
+
+	// Native, non-copying counterpart of GetEdgeConditions.
+	const FMounteaDialogueEdgeConditions& GetEdgeConditionsRef() const
+	{ return EdgeConditions; };
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
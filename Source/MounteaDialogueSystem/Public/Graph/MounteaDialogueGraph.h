@@ -6,6 +6,7 @@
 #include "Templates/SubclassOf.h"
 #include "GameplayTagContainer.h"
 
+#include "Data/MounteaDialogueCompiledGraph.h"
 #include "Decorators/MounteaDialogueDecoratorBase.h"
 #include "Interfaces/Core/MounteaDialogueTickableObject.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
@@ -134,6 +135,38 @@ private:
 	UPROPERTY()
 	bool bIsGraphActive;
 
+	/**
+	 * Transient lookup from Node GUID to its index within AllNodes.
+	 * Built on load/creation and rebuilt explicitly by whoever changes AllNodes, lookups never rebuild it.
+	 */
+	TMap<FGuid, int32> NodeIndexByGuid;
+
+	/**
+	 * Flattened copy of the Graph topology used by runtime traversal.
+	 * Compiled when the Graph is saved or cooked, editor changes recompile it explicitly.
+	 * ❗ Read only once loaded, Sessions share it without locking.
+	 */
+	UPROPERTY()
+	FMounteaDialogueCompiledGraph CompiledGraph;
+
+	/**
+	 * Transitive closure of Graphs this Graph can open through Open Child Graph Nodes.
+	 * Gathered on save/cook, so runtime can stream them in without walking (and loading) the Graphs.
+	 * ❔ Data Tables and row sounds are hard references of those Graphs and stream in with them.
+	 */
+	UPROPERTY()
+	TArray<FSoftObjectPath> ChildGraphDependencies;
+
+	/**
+	 * Append only list of every Node GUID this Graph ever contained, position is the stable Node index.
+	 * Removed Nodes keep their slot, so stable indices stored in save games survive Graph edits.
+	 */
+	UPROPERTY()
+	TArray<FGuid> StableNodeGuids;
+
+	// Transient lookup from Node GUID to its position within StableNodeGuids.
+	TMap<FGuid, int32> StableNodeIndexByGuid;
+
 public:
 
 	/**
@@ -156,6 +189,80 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
 	UMounteaDialogueGraphNode* FindNodeByGuid(const FGuid& NodeGuid);
 
+	/**
+	 * Native, const variant of FindNodeByGuid backed by the GUID index.
+	 * Does not scan AllNodes unless the index is out of date.
+	 * 
+	 * @param NodeGuid The GUID of the node to find.
+	 * @return The dialogue node with the specified GUID, or nullptr if not found.
+	 */
+	UMounteaDialogueGraphNode* GetNodeByGuid(const FGuid& NodeGuid) const;
+
+	/**
+	 * Returns index of the node with given GUID within AllNodes.
+	 * 
+	 * @param NodeGuid The GUID of the node to find.
+	 * @return Index into AllNodes, or INDEX_NONE if not found.
+	 */
+	int32 FindNodeIndexByGuid(const FGuid& NodeGuid) const;
+
+	// Rebuilds the GUID index from AllNodes, call after AllNodes or Node GUIDs change.
+	void RebuildNodeIndex();
+
+	/**
+	 * Returns stable index of the Node with given GUID.
+	 * Unlike indices into AllNodes, stable indices never change once assigned, so they can be stored in save games.
+	 * 
+	 * @param NodeGuid The GUID of the node to find.
+	 * @return Stable Node index, or INDEX_NONE if the Node does not belong to this Graph.
+	 */
+	int32 FindStableNodeIndex(const FGuid& NodeGuid) const;
+
+	// Returns GUID of the Node with given stable index, invalid GUID for unknown indices.
+	FGuid GetStableNodeGuid(const int32 StableIndex) const
+	{ return StableNodeGuids.IsValidIndex(StableIndex) ? StableNodeGuids[StableIndex] : FGuid(); };
+
+	/**
+	 * Returns the compiled, index based representation of this Graph.
+	 * Node indices match AllNodes. Never recompiles, see CompileGraph.
+	 * 
+	 * @return Compiled Graph data.
+	 */
+	const FMounteaDialogueCompiledGraph& GetCompiledGraph() const
+	{ return CompiledGraph; };
+
+	/**
+	 * Rebuilds the compiled Graph from current Nodes and Edges.
+	 * Called on save/cook and by editor changes, Graphs built at runtime must call it once populated.
+	 */
+	void CompileGraph();
+
+#if WITH_EDITOR
+	// Recompiles condition ops only, Blueprint reinstancing replaced conditions they point to.
+	void RecompileConditionOps();
+#endif
+
+private:
+
+	// Assigns stable indices to Nodes which do not have one yet.
+	void RegisterStableNodeIndices();
+
+public:
+
+	/**
+	 * Returns all Graphs which might be opened from this Graph, including nested child Graphs.
+	 * 
+	 * @return Soft paths of the child Graph closure.
+	 */
+	const TArray<FSoftObjectPath>& GetChildGraphDependencies() const
+	{ return ChildGraphDependencies; };
+
+#if WITH_EDITOR
+	// Editor edit invalidated the compiled Graph, recompiles it right away.
+	void InvalidateCompiledGraph()
+	{ CompileGraph(); };
+#endif
+
 	/**
 	 * Returns an array containing all nodes in the dialogue graph.
 	 * 
@@ -172,6 +279,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
 	TArray<UMounteaDialogueGraphNode*> GetRootNodes() const;
 
+	// Native, non-copying counterpart of GetAllNodes.
+	TConstArrayView<TObjectPtr<UMounteaDialogueGraphNode>> GetAllNodesView() const
+	{ return AllNodes; };
+
+	// Native, non-copying counterpart of GetRootNodes.
+	TConstArrayView<TObjectPtr<UMounteaDialogueGraphNode>> GetRootNodesView() const
+	{ return RootNodes; };
+
 	/**
 	 * Returns the root nodes of the dialogue graph.
 	 *
@@ -188,6 +303,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
 	TArray<FMounteaDialogueDecorator> GetGraphDecorators() const;
 
+	// Appends valid, unique Graph Decorators without allocating a new array.
+	void AppendGraphDecorators(FMounteaDialogueDecoratorBuffer& OutDecorators) const;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
 	TArray<FMounteaDialogueDecorator> GetGraphScopeDecorators() const;
 	
@@ -230,6 +348,8 @@ public:
 	}
 	
 	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 
 	virtual void
 	RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable) override;
@@ -287,6 +407,12 @@ public:
 	virtual void AddDecoratorErrors(FDataValidationContext& Context, bool RichTextFormat, const TArray<FText>& DecoratorErrors, const FString& DecoratorTypeName) const;
 	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) override;
 
+	// Walks Open Child Graph Nodes (loading the targets) and stores the child Graph closure.
+	void GatherChildGraphDependencies();
+
+	// Rebuilds index aligned ChildEdges of every Node from their editor Edges maps.
+	void RebuildChildEdges();
+
 public:
 	// Construct and initialize a node within this Dialogue.
 	template <class T>
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Conditions/MounteaDialogueConditionBase.h"
 #include "Interfaces/Core/MounteaDialogueConditionContextInterface.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "MounteaDialogueConditionsStatics.generated.h"
@@ -71,4 +72,41 @@ public:
 	static bool EvaluateEdgeConditions(
 		const UMounteaDialogueGraphEdge* Edge,
 		const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context);
+
+	/**
+	 * Evaluates a set of condition rules using given evaluation mode.
+	 * Native counterpart of EvaluateEdgeConditions, used with compiled Graph condition ranges.
+	 *
+	 * @param Rules    Rules to evaluate. Empty set is treated as unconditional (returns true).
+	 * @param Mode     Evaluation mode of the rules.
+	 * @param Context  Condition context exposing traversal history, active participant, and session GUID.
+	 * @return True if the rules pass.
+	 */
+	static bool EvaluateConditionRules(
+		TConstArrayView<FMounteaDialogueCondition> Rules,
+		const EConditionEvaluationMode Mode,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context);
+
+	/**
+	 * Compiles condition rules of one Edge into condition steps, appended to OutOps.
+	 * One step per rule, native conditions are ordered before Blueprint ones if every Blueprint condition is Pure.
+	 * ❗ Rules with Blueprint conditions of other caching keep their authored order, those might have side effects.
+	 */
+	static void CompileConditionRules(
+		TConstArrayView<FMounteaDialogueCondition> Rules,
+		TArray<FMounteaDialogueConditionOp>& OutOps);
+
+	/**
+	 * Compiled counterpart of EvaluateConditionRules.
+	 * Native conditions are called directly, the Blueprint VM is entered only for Blueprint conditions which short-circuit did not skip.
+	 *
+	 * @param Ops      Steps produced by CompileConditionRules. Empty set is treated as unconditional (returns true).
+	 * @param Mode     Evaluation mode of the rules.
+	 * @param Context  Condition context exposing traversal history, active participant, and session GUID.
+	 * @return True if the rules pass.
+	 */
+	static bool EvaluateConditionOps(
+		TConstArrayView<FMounteaDialogueConditionOp> Ops,
+		const EConditionEvaluationMode Mode,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context);
 };
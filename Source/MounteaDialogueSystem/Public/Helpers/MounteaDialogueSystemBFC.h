@@ -6,6 +6,7 @@
 #include "Settings/MounteaDialogueSystemSettings.h"
 
 #include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Data/MounteaDialogueRowCache.h"
 
 #include "Interfaces/Core/MounteaDialogueConditionContextInterface.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
@@ -274,8 +275,8 @@ public:
 		if (Table == nullptr) return FDialogueRow::Invalid();
 		if (Table->RowStruct->IsChildOf(FDialogueRow::StaticStruct()) == false) return FDialogueRow::Invalid();
 
-		const FDialogueRow* Row = Table->FindRow<FDialogueRow>(RowName, FString("") );
-		if (!Row) return FDialogueRow::Invalid();
+		const TSharedPtr<const FDialogueRow> Row = FMounteaDialogueRowCache::FindRow(Table, RowName);
+		if (!Row.IsValid()) return FDialogueRow::Invalid();
 		if (IsDialogueRowValid(*Row) == false) return FDialogueRow::Invalid();
 
 		return *Row;
@@ -0,0 +1,52 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueTimingWheel.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "MounteaDialogueTimerStatics.generated.h"
+
+/**
+ * Blueprint access to dialogue timers running on the World Subsystem timing wheel.
+ * Replaces Timer Manager nodes for handles like the Row typewriter timers and the Manager row timer.
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueTimerStatics : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers|Timers",
+		meta=(WorldContext="WorldContextObject"),
+		meta=(CustomTag="MounteaK2Validate"))
+	static bool IsDialogueTimerActive(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle);
+
+	// Cancels given dialogue timer and invalidates the handle.
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Helpers|Timers",
+		meta=(WorldContext="WorldContextObject"))
+	static void ClearDialogueTimer(const UObject* WorldContextObject, UPARAM(ref) FMounteaDialogueTimerHandle& Handle);
+
+	// Returns seconds until given dialogue timer expires, -1 if it is not active.
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers|Timers",
+		meta=(WorldContext="WorldContextObject"),
+		meta=(CustomTag="MounteaK2Getter"))
+	static float GetDialogueTimerRemaining(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle);
+
+	// Returns seconds since given dialogue timer started, -1 if it is not active.
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers|Timers",
+		meta=(WorldContext="WorldContextObject"),
+		meta=(CustomTag="MounteaK2Getter"))
+	static float GetDialogueTimerElapsed(const UObject* WorldContextObject, const FMounteaDialogueTimerHandle& Handle);
+};
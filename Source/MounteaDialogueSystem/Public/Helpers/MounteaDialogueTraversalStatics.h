@@ -23,6 +23,9 @@ class UMounteaDialogueGraph;
 class UMounteaDialogueGraphNode;
 class UDataTable;
 
+// Node list used by native traversal, fits the children of almost every Node without touching the heap.
+using FMounteaDialogueNodeBuffer = TArray<UMounteaDialogueGraphNode*, TInlineAllocator<16>>;
+
 UCLASS()
 class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueTraversalStatics : public UBlueprintFunctionLibrary
 {
@@ -36,6 +39,31 @@ public:
 		const UMounteaDialogueGraphNode* ParentNode,
 		const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext);
 
+	/**
+	 * Same as GetAllowedChildNodesFiltered followed by SortNodes, but filters and sorts
+	 * on the compiled Graph data instead of the Node objects.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
+		meta=(CustomTag="MounteaK2Getter"))
+	static TArray<UMounteaDialogueGraphNode*> GetAllowedChildNodesSorted(
+		const UMounteaDialogueGraphNode* ParentNode,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext);
+
+	/**
+	 * Native, allocation free variant of GetAllowedChildNodesFiltered/GetAllowedChildNodesSorted.
+	 * Blueprint functions above are thin wrappers copying the result.
+	 *
+	 * @param ParentNode        Node whose children are filtered.
+	 * @param ConditionContext  Context used to evaluate Edge conditions.
+	 * @param OutNodes          Caller provided buffer, reset before it is filled.
+	 * @param bSortByExecutionOrder  If true, children are stable sorted by Execution Order.
+	 */
+	static void GetAllowedChildNodes(
+		const UMounteaDialogueGraphNode* ParentNode,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext,
+		FMounteaDialogueNodeBuffer& OutNodes,
+		const bool bSortByExecutionOrder);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
 		meta=(CustomTag="MounteaK2Getter"))
 	static UMounteaDialogueGraphNode* GetFirstChildNode(const UMounteaDialogueGraphNode* ParentNode);
@@ -52,6 +80,15 @@ public:
 		meta=(CustomTag="MounteaK2Getter"))
 	static FDialogueRow GetDialogueRow(const UDataTable* SourceTable, FName SourceName);
 
+	/**
+	 * Native counterpart of GetSpeechData which does not copy the row.
+	 * Dialogue Nodes are served from the shared row cache, other speech data providers are copied once.
+	 */
+	static TSharedRef<const FDialogueRow> GetSpeechDataShared(const UMounteaDialogueGraphNode* Node);
+
+	// Native counterpart of GetDialogueRow served from the shared row cache.
+	static TSharedRef<const FDialogueRow> GetDialogueRowShared(const UDataTable* SourceTable, FName SourceName);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
 		meta=(CustomTag="MounteaK2Validate"))
 	static bool IsDialogueRowValid(const FDialogueRow& Row);
@@ -64,16 +101,37 @@ public:
 		meta=(CustomTag="MounteaK2Getter"))
 	static float GetRowDuration(const FDialogueRowData& Row);
 
+	/**
+	 * Returns duration of the Row Data currently active in the Context.
+	 * Uses durations precomputed by the row cache and only calculates it for rows which are not cached.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
+		meta=(CustomTag="MounteaK2Getter"))
+	static float GetActiveRowDuration(const UMounteaDialogueContext* Context);
+
+	// Calculates the duration from scratch using given Duration Coefficient.
+	static float CalculateRowDuration(const FDialogueRowData& Row, const float DurationCoefficient);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
 		meta=(CustomTag="MounteaK2Getter"))
 	static TArray<FMounteaDialogueDecorator> GetAllDialogueDecorators(const UMounteaDialogueGraph* FromGraph);
 
+	/**
+	 * Scans given Traversed Path.
+	 * ❔ Prefer HasNodeBeenTraversedInContext, native contexts answer from a hash index without copying their path.
+	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
 		meta=(CustomTag="MounteaK2Validate"))
 	static bool HasNodeBeenTraversed(
 		const UMounteaDialogueGraphNode* Node,
 		const TArray<FDialogueTraversePath>& TraversedPath);
 
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
+		meta=(CustomTag="MounteaK2Validate"))
+	static bool HasNodeBeenTraversedInContext(
+		const UMounteaDialogueGraphNode* Node,
+		const TScriptInterface<IMounteaDialogueConditionContextInterface>& ConditionContext);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers",
 		meta=(CustomTag="MounteaK2Getter"))
 	static TScriptInterface<IMounteaDialogueParticipantInterface> FindParticipantByTag(
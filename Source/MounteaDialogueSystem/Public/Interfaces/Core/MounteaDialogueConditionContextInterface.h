@@ -18,6 +18,8 @@
 #include "MounteaDialogueConditionContextInterface.generated.h"
 
 class IMounteaDialogueParticipantInterface;
+class FMounteaDialogueConditionCache;
+struct FMounteaDialogueConditionRevision;
 
 UINTERFACE(MinimalAPI, BlueprintType, Blueprintable)
 class UMounteaDialogueConditionContextInterface : public UInterface
@@ -60,4 +62,17 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Dialogue|Condition")
 	FGuid GetConditionSessionGUID() const;
 	virtual FGuid GetConditionSessionGUID_Implementation() const = 0;
+
+	/**
+	 * Native only. Returns cache of condition results owned by this context, together with the current revision of the context.
+	 * Null disables caching, conditions are then evaluated every time.
+	 */
+	virtual FMounteaDialogueConditionCache* GetConditionCache(FMounteaDialogueConditionRevision& OutRevision) const
+	{ return nullptr; };
+
+	/**
+	 * Native only. Returns how many times given Node was traversed in this context, 0 if never.
+	 * Default scans GetConditionTraversedPath, native contexts answer from a hash index without copying the path.
+	 */
+	virtual int32 GetConditionTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Data/MounteaDialogueTimingWheel.h"
 #include "Data/MounteaDialogueUITypes.h"
 #include "UObject/Interface.h"
 #include "MounteaDialogueManagerInterface.generated.h"
@@ -359,7 +360,16 @@ public:
 
 	virtual FDialogueWidgetCommand& GetDialogueWidgetCommandHandle() = 0;
 
-	virtual FTimerHandle& GetDialogueRowTimerHandle() = 0;
+	// Row timer runs on the World Subsystem dialogue timers, see UMounteaDialogueTimerStatics for Blueprint access.
+	virtual FMounteaDialogueTimerHandle& GetDialogueRowTimer() = 0;
+
+	// ❗ Nothing schedules this handle anymore, it is kept only so existing overrides keep compiling.
+	UE_DEPRECATED(5.7, "Row timer moved to the dialogue timing wheel, use GetDialogueRowTimer instead.")
+	virtual FTimerHandle& GetDialogueRowTimerHandle()
+	{
+		static FTimerHandle unusedTimerHandle;
+		return unusedTimerHandle;
+	};
 
 	virtual FDialogueUISignalEvent& GetDialogueUISignalEventHandle() = 0;
 };
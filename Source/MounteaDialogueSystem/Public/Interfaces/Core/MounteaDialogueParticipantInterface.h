@@ -220,6 +220,12 @@ public:
 	TArray<FDialogueTraversePath> GetTraversedPath() const;
 	virtual TArray<FDialogueTraversePath> GetTraversedPath_Implementation() const = 0;
 
+	/**
+	 * Native only. Returns how many times given Node was traversed by this Participant, 0 if never.
+	 * Default scans GetTraversedPath, native Participants answer from a hash index without copying the path.
+	 */
+	virtual int32 GetNodeTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const;
+
 	/**
 	 * Processes a dialogue command for the Dialogue Participant.
 	 *
@@ -69,14 +69,26 @@ public:
 	TArray<UMounteaDialogueGraphNode*> ChildrenNodes;
 	
 	/**
-	 * Map of edges connecting this Node in the Mountea Dialogue Graph.
-	 *❗ The key of the map is the source node, and the value is the edge connecting it to its target node.
-	 *❔ Can be used to traverse the graph, get information about node connections...
+	 * Edges leading to the children nodes, aligned with ChildrenNodes (Edge 'i' leads to ChildrenNodes[i]).
+	 *❗ Might contain null for children connected without an Edge.
+	 *❔ Rebuilt from the editor Edges map whenever the Graph is loaded in editor or compiled.
 	 */
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Private", 
 		meta=(DisplayThumbnail=false),
 		meta=(NoResetToDefault),
 		meta=(HiddenInGraph))
+	TArray<UMounteaDialogueGraphEdge*> ChildEdges;
+
+	/**
+	 * Map of edges connecting this Node in the Mountea Dialogue Graph.
+	 *❗ The key of the map is the child node, and the value is the edge connecting it to its target node.
+	 *❗ Deprecated, use GetEdge or ChildEdges. Kept so existing Blueprints keep working, editor keeps it in sync.
+	 */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Private", 
+		meta=(DisplayThumbnail=false),
+		meta=(NoResetToDefault),
+		meta=(HiddenInGraph),
+		meta=(DeprecatedProperty, DeprecationMessage="Edges map is deprecated, use GetEdge instead."))
 	TMap<UMounteaDialogueGraphNode*, UMounteaDialogueGraphEdge*> Edges;
 	
 	/**
@@ -233,6 +245,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Node", 
 		meta=(CustomTag="MounteaK2Getter"))
 	TArray<FMounteaDialogueDecorator> GetNodeDecorators() const;
+
+	// Appends valid, unique Node Decorators without allocating a new array.
+	void AppendNodeDecorators(FMounteaDialogueDecoratorBuffer& OutDecorators) const;
 	
 	/**
 	 * Returns true if the node can be started.
@@ -335,6 +350,33 @@ public:
 	FORCEINLINE TArray<UMounteaDialogueGraphNode*> GetParentNodes() const
 	{return ParentNodes; };
 
+	// Native, non-copying counterpart of GetChildrenNodes.
+	FORCEINLINE TConstArrayView<UMounteaDialogueGraphNode*> GetChildrenNodesView() const
+	{ return ChildrenNodes; };
+
+	// Native, non-copying counterpart of GetParentNodes.
+	FORCEINLINE TConstArrayView<UMounteaDialogueGraphNode*> GetParentNodesView() const
+	{ return ParentNodes; };
+
+	// Returns Edge leading to ChildrenNodes[ChildIndex], null if there is none.
+	FORCEINLINE UMounteaDialogueGraphEdge* GetChildEdge(const int32 ChildIndex) const
+	{ return ChildEdges.IsValidIndex(ChildIndex) ? ChildEdges[ChildIndex] : nullptr; };
+
+	/**
+	 * Returns Edge leading to given child Node.
+	 *❔ Replaces the deprecated Edges map.
+	 * 
+	 * @param Child Child Node the Edge leads to.
+	 * @return Edge leading to the child, null if the Node is not a child or has no Edge.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Node", meta=(CustomTag="MounteaK2Getter"))
+	UMounteaDialogueGraphEdge* GetEdge(const UMounteaDialogueGraphNode* Child) const;
+
+#if WITH_EDITOR
+	// Rebuilds ChildEdges from the editor Edges map so it matches the current ChildrenNodes order.
+	void RebuildChildEdges();
+#endif
+
 	/**
 	 * Serves purpose of validating Node before Dialogue gets Started.
 	 * Any broken Node results in non-starting Dialogue to avoid crashes.
@@ -44,10 +44,6 @@ private:
 
 	UFUNCTION()
 	void OnDelayDurationExpired(const TScriptInterface<IMounteaDialogueManagerInterface>& MounteaDialogueManagerInterface);
-	
-private:
-
-	FTimerHandle TimerHandle_NodeDelay;
 
 #if WITH_EDITOR
 	virtual FText GetDescription_Implementation() const override;
@@ -35,6 +35,12 @@ public:
 	virtual FDialogueRow GetSpeechData_Implementation() const override;
 	virtual bool SetSpeechData_Implementation(const FDialogueRow& NewSpeechData) override;
 
+	/**
+	 * Returns the Dialogue Row from the shared row cache, without copying it.
+	 * ❔ GetSpeechData returns a copy of the same row.
+	 */
+	TSharedRef<const FDialogueRow> GetSharedSpeechData() const;
+
 	/**
 	 * Returns the Dialogue Data Table for this graph node.
 	 * ❗ Might be null
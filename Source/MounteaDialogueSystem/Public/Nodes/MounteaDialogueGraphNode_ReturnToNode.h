@@ -74,8 +74,6 @@ public:
 
 protected:
 
-	FTimerHandle TimerHandle_Delay;
-
 	UFUNCTION()
 	void OnDelayDurationExpired(const TScriptInterface<IMounteaDialogueManagerInterface>& MounteaDialogueManagerInterface);
 
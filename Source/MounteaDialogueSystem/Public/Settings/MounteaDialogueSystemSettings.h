@@ -69,6 +69,40 @@ protected:
 		meta=(NoResetToDefault))
 	float ClientPredictionTimeoutSeconds = 0.75f;
 
+	/**
+	 * Players within this distance of the active speaker receive the Dialogue too, 0 disables eavesdropping.
+	 * Other connections receive only Dialogues they take part in.
+	 * ❔ Requires the GameState to replicate using registered subobject list.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Networking",
+		meta=(UIMin=0, ClampMin=0, Units="cm"),
+		meta=(NoResetToDefault))
+	float EavesdropRadius = 0.f;
+
+	/**
+	 * How often players around the active speaker are collected while Eavesdrop Radius is enabled.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Networking",
+		meta=(UIMin=0.1, ClampMin=0.1, Units="s"),
+		meta=(NoResetToDefault))
+	float EavesdropRefreshInterval = 0.5f;
+
+	/**
+	 * If true, all Graphs a Dialogue can open through Open Child Graph Nodes are streamed in when the session starts.
+	 * If false, they are streamed in only once the active Node gets close to an Open Child Graph Node.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Streaming",
+		meta=(NoResetToDefault))
+	bool bPreloadChildGraphsOnSessionStart = true;
+
+	/**
+	 * How many Nodes ahead of an Open Child Graph Node its target Graphs start streaming in.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Streaming",
+		meta=(UIMin=0, ClampMin=0),
+		meta=(NoResetToDefault))
+	int32 ChildGraphPreloadDistance = 2;
+
 	/**
 	 * List of General Dialogue Settings.
 	 * Defines font, sizes etc. for all subtitles.
@@ -196,6 +230,18 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
 	float GetClientPredictionTimeoutSeconds() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	float GetEavesdropRadius() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	float GetEavesdropRefreshInterval() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Validate"))
+	bool ShouldPreloadChildGraphsOnSessionStart() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetChildGraphPreloadDistance() const;
 	
 	void SetDialogueConfiguration(const TSoftObjectPtr<UMounteaDialogueConfiguration> NewDialogueConfiguration);
 	
@@ -0,0 +1,219 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaDialogueGraphRegistrySubsystem.generated.h"
+
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+struct FStreamableHandle;
+
+// Graph GUID and the resident Graph, null Graph if the load failed.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMounteaDialogueGraphLoadFinished, const FGuid&, UMounteaDialogueGraph*);
+
+/**
+ * Load state of a Dialogue Graph known to the Graph Registry.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueGraphLoadState : uint8
+{
+	Unknown			UMETA(DisplayName="Unknown"),
+	// Graph is referenced by a known Graph, but is not resident.
+	NotLoaded		UMETA(DisplayName="Not Loaded"),
+	Loading			UMETA(DisplayName="Loading"),
+	Loaded			UMETA(DisplayName="Loaded"),
+	Failed			UMETA(DisplayName="Failed")
+};
+
+/**
+ * Single Graph Registry record.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueGraphRegistryEntry
+{
+	GENERATED_BODY()
+
+	// Soft path of the Graph asset, always valid for Graphs discovered through Open Child Graph Nodes.
+	UPROPERTY(BlueprintReadOnly, Category="Registry")
+	TSoftObjectPtr<UMounteaDialogueGraph> GraphAsset;
+
+	/**
+	 * Resident Graph, null unless LoadState is Loaded.
+	 * ❗ Weak, streaming handles and Sessions keep the Graph resident, the registry never does.
+	 */
+	UPROPERTY()
+	TWeakObjectPtr<UMounteaDialogueGraph> Graph;
+
+	UPROPERTY(BlueprintReadOnly, Category="Registry")
+	EMounteaDialogueGraphLoadState LoadState = EMounteaDialogueGraphLoadState::Unknown;
+
+	// Graphs opened from this Graph by Open Child Graph Nodes. Only known once this Graph is loaded.
+	UPROPERTY(BlueprintReadOnly, Category="Registry")
+	TArray<FGuid> ChildGraphGUIDs;
+};
+
+/**
+ * UMounteaDialogueGraphRegistrySubsystem keeps a per-world registry of Dialogue Graphs keyed by Graph GUID.
+ *
+ * Graphs are registered once (from participants, start requests or loaded child graphs) together with
+ * the Graphs they open, so runtime lookups by GUID are a single map find.
+ * Resolving never loads anything synchronously, not yet resident Graphs are reported with their load state
+ * and can be streamed in using RequestGraphLoad.
+ *
+ * @see UMounteaDialogueWorldSubsystem
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueGraphRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+public:
+
+	/**
+	 * Registers a resident Graph and every Graph it opens through Open Child Graph Nodes.
+	 * Child Graphs which are already resident are registered recursively, others are recorded as not loaded.
+	 *
+	 * @param Graph  Graph to register.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Setter"))
+	void RegisterGraph(UMounteaDialogueGraph* Graph);
+
+	/**
+	 * Returns resident Graph with given GUID.
+	 * ❗ Never loads, returns null for Graphs which are not loaded yet.
+	 *
+	 * @param GraphGUID  GUID of the Graph to find.
+	 * @return Resident Graph or null.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Getter"))
+	UMounteaDialogueGraph* FindGraph(const FGuid& GraphGUID) const;
+
+	/**
+	 * Returns resident Graph for given soft reference, registering it if it was not known yet.
+	 * ❗ Never loads, returns null for Graphs which are not loaded yet.
+	 */
+	UMounteaDialogueGraph* FindGraphByAsset(const TSoftObjectPtr<UMounteaDialogueGraph>& GraphAsset);
+
+	/**
+	 * Returns load state of the Graph with given GUID.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Getter"))
+	EMounteaDialogueGraphLoadState GetGraphLoadState(const FGuid& GraphGUID) const;
+
+	/**
+	 * Starts asynchronous load of a known, not yet resident Graph.
+	 * Loaded Graph is registered automatically.
+	 *
+	 * @param GraphGUID  GUID of the Graph to load.
+	 * @return True if the Graph is already loaded or loading was requested.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Setter"))
+	bool RequestGraphLoad(const FGuid& GraphGUID);
+
+	/**
+	 * Streams in every Graph the given Graph can open (its save time child Graph closure).
+	 * Loaded Graphs are registered and kept resident, so opening them later is only a lookup.
+	 * Requests are counted, every call has to be paired with ReleaseChildGraphs.
+	 *
+	 * @param Graph  Graph whose child Graphs should be streamed in.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Setter"))
+	void PreloadChildGraphs(UMounteaDialogueGraph* Graph);
+
+	/**
+	 * Returns true if the Node is close enough to an Open Child Graph Node to preload child Graphs of its Graph.
+	 * Distance is configured in Mountea Dialogue System settings.
+	 *
+	 * @param ActiveNode  Node which has just become active.
+	 */
+	bool IsNodeNearChildGraph(const UMounteaDialogueGraphNode* ActiveNode) const;
+
+	/**
+	 * Releases one PreloadChildGraphs request. Once every request is released the streaming handle is released
+	 * and child Graph entries are downgraded to NotLoaded, child Graphs might get garbage collected afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Graph Registry",
+		meta=(CustomTag="MounteaK2Setter"))
+	void ReleaseChildGraphs(const FGuid& GraphGUID);
+
+	/**
+	 * Broadcast once a Graph becomes resident and registered, or once its load fails.
+	 * Lets code waiting on RequestGraphLoad or PreloadChildGraphs continue without polling.
+	 */
+	FMounteaDialogueGraphLoadFinished& OnGraphLoadFinished()
+	{ return GraphLoadFinishedEvent; };
+
+	// Returns the registry record for given GUID, null if unknown.
+	const FMounteaDialogueGraphRegistryEntry* FindEntry(const FGuid& GraphGUID) const
+	{ return RegisteredGraphs.Find(GraphGUID); };
+
+	// Convenience accessor, returns null if World is not valid.
+	static UMounteaDialogueGraphRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+private:
+
+	/**
+	 * Registers a not yet resident Graph, resolving its GUID from the Asset Registry tags.
+	 *
+	 * @return GUID of the Graph, invalid if it could not be resolved without loading.
+	 */
+	FGuid RegisterGraphAsset(const TSoftObjectPtr<UMounteaDialogueGraph>& GraphAsset);
+
+	/**
+	 * Promotes NotLoaded entry to Loaded if the Graph became resident in the meantime.
+	 * Loaded entry whose Graph was garbage collected is downgraded to NotLoaded.
+	 */
+	UMounteaDialogueGraph* TryPromoteResidentGraph(FMounteaDialogueGraphRegistryEntry& Entry);
+
+	/**
+	 * Downgrades entries of Graphs requested by a released child Graph handle, nothing keeps them resident anymore.
+	 * Entries still loading by a cancelled handle are reset to NotLoaded and reported as failed loads.
+	 */
+	void ReleaseChildGraphEntries(const FStreamableHandle& LoadHandle);
+
+	void HandleGraphLoaded(FGuid GraphGUID);
+
+	void HandleChildGraphsLoaded(FGuid GraphGUID);
+
+private:
+
+	UPROPERTY(Transient)
+	TMap<FGuid, FMounteaDialogueGraphRegistryEntry> RegisteredGraphs;
+
+	// Soft path to GUID lookup for Graphs referenced by path only.
+	TMap<FSoftObjectPath, FGuid> GraphGUIDsByPath;
+
+	TMap<FGuid, TSharedPtr<FStreamableHandle>> PendingLoads;
+
+	// Child Graph closure handles, keyed by GUID of the parent Graph.
+	TMap<FGuid, TSharedPtr<FStreamableHandle>> ChildGraphHandles;
+
+	// Amount of unreleased PreloadChildGraphs requests, keyed by GUID of the parent Graph.
+	TMap<FGuid, int32> ChildGraphRequests;
+
+	FMounteaDialogueGraphLoadFinished GraphLoadFinishedEvent;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FMounteaDialogueGraphRegistryCancelTest;
+#endif
+};
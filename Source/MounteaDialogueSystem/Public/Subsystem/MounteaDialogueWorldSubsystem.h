@@ -12,24 +12,105 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/MounteaDialogueSessionStats.h"
+#include "Data/MounteaDialogueTimingWheel.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "MounteaDialogueWorldSubsystem.generated.h"
 
 class UMounteaDialogueSession;
 class UMounteaDialogueManager;
+class UMounteaDialogueGraph;
+class UNetConnection;
+class UDataTable;
+class AGameModeBase;
+class AController;
 struct FDialogueStartRequest;
-class IMounteaDialogueParticipantInterface;
+struct FStreamableHandle;
+
+/**
+ * Stages of the asynchronous dialogue start pipeline.
+ * Final states are Completed, Cancelled and Failed.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueStartStage : uint8
+{
+	None			UMETA(DisplayName="None"),
+	// Participants, Session and Graph reference are resolved, nothing is loaded.
+	Resolve			UMETA(DisplayName="Resolve"),
+	// Graph (and with it Data Tables and row sounds) is streamed in.
+	Stream			UMETA(DisplayName="Stream"),
+	// First Node, active participant and allowed children are evaluated.
+	Evaluate		UMETA(DisplayName="Evaluate"),
+	// Payload is written and the manager is notified.
+	Commit			UMETA(DisplayName="Commit"),
+	Completed		UMETA(DisplayName="Completed"),
+	Cancelled		UMETA(DisplayName="Cancelled"),
+	Failed			UMETA(DisplayName="Failed")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDialogueStartOperationFinished, UMounteaDialogueManager*, Manager, const FGuid&, SessionGUID, EMounteaDialogueStartStage, Result);
+
+/**
+ * State of a single in-flight dialogue start request.
+ */
+USTRUCT()
+struct FMounteaDialogueStartOperation
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UMounteaDialogueManager> Manager = nullptr;
+
+	UPROPERTY()
+	TScriptInterface<IMounteaDialogueParticipantInterface> MainParticipant;
+
+	UPROPERTY()
+	TArray<TScriptInterface<IMounteaDialogueParticipantInterface>> AllParticipants;
+
+	UPROPERTY()
+	TSoftObjectPtr<UMounteaDialogueGraph> GraphAsset;
+
+	// Resident Graph, set once the Stream stage finished.
+	UPROPERTY()
+	TObjectPtr<UMounteaDialogueGraph> Graph = nullptr;
+
+	UPROPERTY()
+	EMounteaDialogueStartStage Stage = EMounteaDialogueStartStage::None;
+
+	TSharedPtr<FStreamableHandle> StreamHandle;
+};
+
+/**
+ * Locks held by a single dialogue session, from the start request until the dialogue is closed.
+ */
+struct FMounteaDialogueSessionLock
+{
+	TObjectKey<UMounteaDialogueManager> Manager;
+
+	TArray<TObjectKey<UObject>> Participants;
+
+	// Pooled Session, null until the start request is committed.
+	TWeakObjectPtr<UMounteaDialogueSession> Session;
+};
 
 /**
  * UMounteaDialogueWorldSubsystem manages active dialogue sessions and registered managers
  * for the current world. It serves as the central registry for all dialogue activity,
  * bridging start requests to session allocation and providing participant lookup.
  *
+ * Any amount of dialogues can run at once. Every dialogue gets its own Session from a pool of
+ * Session components living on the GameState, locks are held per manager and per participant.
+ *
+ * Dialogue timers (row durations, Delay Nodes, typewriter) run on a timing wheel ticked by this subsystem,
+ * so they follow world time dilation and stop while the game is paused.
+ *
  * @see UMounteaDialogueSession
  * @see UMounteaDialogueManager
  */
 UCLASS()
-class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueWorldSubsystem : public UWorldSubsystem
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueWorldSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -38,6 +119,38 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// ~FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	// ~FTickableGameObject
+
+public:
+
+	/**
+	 * Starts a one shot dialogue timer.
+	 * Timers expiring within a frame fire together in the order they were due.
+	 *
+	 * @param Delegate  Called once the timer expires.
+	 * @param Delay     Seconds of world time until expiration.
+	 * @return Handle of the timer.
+	 */
+	FMounteaDialogueTimerHandle SetDialogueTimer(const FTimerDelegate& Delegate, const float Delay);
+
+	// Cancels given dialogue timer and invalidates the handle.
+	void ClearDialogueTimer(FMounteaDialogueTimerHandle& Handle);
+
+	bool IsDialogueTimerActive(const FMounteaDialogueTimerHandle& Handle) const
+	{ return DialogueTimers.IsTimerActive(Handle); };
+
+	// Returns seconds since given dialogue timer started, -1 if it is not active.
+	float GetDialogueTimerElapsed(const FMounteaDialogueTimerHandle& Handle) const
+	{ return DialogueTimers.GetTimerElapsed(Handle); };
+
+	// Returns seconds until given dialogue timer expires, -1 if it is not active.
+	float GetDialogueTimerRemaining(const FMounteaDialogueTimerHandle& Handle) const
+	{ return DialogueTimers.GetTimerRemaining(Handle); };
+
 public:
 
 	/**
@@ -60,6 +173,14 @@ public:
 		meta=(CustomTag="MounteaK2Setter"))
 	void UnregisterManager(UMounteaDialogueManager* Manager);
 
+	/**
+	 * Client-only. Delivers payloads which replicated before given manager registered.
+	 * Called from manager and participant UI registration, replaces polling for the manager.
+	 *
+	 * @param Manager  Manager which became able to receive payloads.
+	 */
+	void DispatchPendingClientPayloads(const UMounteaDialogueManager* Manager);
+
 	/**
 	 * Returns a read-only view of all currently registered managers.
 	 */
@@ -70,6 +191,7 @@ public:
 
 	/**
 	 * Returns a read-only view of all currently active dialogue sessions.
+	 * Server-only, clients track Sessions through GetRegisteredSessions.
 	 */
 	const TArray<TObjectPtr<UMounteaDialogueSession>>& GetActiveSessions() const
 	{
@@ -77,21 +199,98 @@ public:
 	}
 
 	/**
-	 * Finds the UMounteaDialogueSession component on the current AGameState.
-	 * Returns null if the component is not present — project must add it to their GameState BP.
+	 * Returns every Session component which has begun play in this world, active or pooled.
+	 */
+	const TArray<TObjectPtr<UMounteaDialogueSession>>& GetRegisteredSessions() const
+	{
+		return RegisteredSessions;
+	}
+
+	/**
+	 * Finds the UMounteaDialogueSession component placed on the current AGameState.
+	 * It is the first pooled Session, additional Sessions are created with its class.
+	 * Returns null if the component is not present.
 	 */
 	UMounteaDialogueSession* GetGameStateSession() const;
 
+	/**
+	 * Returns the Session running dialogue with given GUID, null if there is none.
+	 */
+	UMounteaDialogueSession* FindSession(const FGuid& SessionGUID) const;
+
+	/**
+	 * Returns the Session owned by given manager, null if the manager has no active dialogue.
+	 * Works on both server and clients.
+	 */
+	UMounteaDialogueSession* FindSessionForManager(const UMounteaDialogueManager* Manager) const;
+
+	/**
+	 * Returns the Session given participant takes part in, null if the participant is not in any dialogue.
+	 *
+	 * @param Participant  Participant object (usually the Participant component).
+	 */
+	UMounteaDialogueSession* FindSessionForParticipant(const UObject* Participant) const;
+
+	/**
+	 * Returns the participant of given actor, the actor itself or its first participant component.
+	 * Results are cached until the actor ends play or the component unregisters, so replicated payloads
+	 * re-resolve an unchanged roster without walking actor components again.
+	 */
+	TScriptInterface<IMounteaDialogueParticipantInterface> ResolveCachedParticipant(AActor* ParticipantActor);
+
+	// Drops the cached participant of given actor.
+	void InvalidateParticipantCache(const AActor* ParticipantActor);
+
+	/**
+	 * Returns true if given participant is locked by a running or starting dialogue.
+	 * Server-only.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|World Subsystem",
+		meta=(CustomTag="MounteaK2Validate"))
+	bool IsParticipantLocked(const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant) const;
+
+	// Called by Sessions from BeginPlay and EndPlay.
+	void RegisterSession(UMounteaDialogueSession* Session);
+	void UnregisterSession(UMounteaDialogueSession* Session);
+
 	/**
 	 * Handles an incoming start request forwarded from a manager's server RPC.
-	 * Resolves participants, validates them, creates context, and triggers dialogue start.
 	 * Must be called on the server.
 	 *
+	 * Start runs as a staged pipeline: Resolve -> Stream -> Evaluate -> Commit.
+	 * Resolve runs immediately, Stream waits for the Graph to be streamed in without blocking the frame,
+	 * Evaluate and Commit run once everything the first Node needs is resident.
+	 * The manager's start result (DialogueStartRequestReceived) is broadcast only from Commit or on failure.
+	 *
 	 * @param Manager  The manager that initiated the request.
 	 * @param Request  The packed start request with soft actor references.
 	 */
 	void HandleStartRequest(UMounteaDialogueManager* Manager, const FDialogueStartRequest& Request);
 
+	/**
+	 * Cancels a start request of given manager which has not been committed yet.
+	 * Server-only.
+	 *
+	 * @param Manager  Manager whose pending start should be cancelled.
+	 * @return True if a pending start was cancelled.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|World Subsystem",
+		meta=(CustomTag="MounteaK2Setter"))
+	bool CancelStartRequest(UMounteaDialogueManager* Manager);
+
+	/**
+	 * Returns true if given manager has a start request which is still in progress.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|World Subsystem",
+		meta=(CustomTag="MounteaK2Validate"))
+	bool IsStartRequestPending(const UMounteaDialogueManager* Manager) const;
+
+	/**
+	 * Broadcast when a start request reaches a final stage (Completed, Cancelled or Failed).
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Mountea|Dialogue|World Subsystem")
+	FOnDialogueStartOperationFinished OnDialogueStartOperationFinished;
+
 	/**
 	 * Starts an environment (NPC-NPC or monologue) dialogue directly on the server.
 	 * No RPC — environment managers are server-side only.
@@ -102,11 +301,49 @@ public:
 	void RequestStartEnvironmentDialogue(UMounteaDialogueManager* Manager, const FDialogueStartRequest& Request);
 
 	/**
-	 * Releases the single-dialogue lock if the caller matches the active lock owner.
+	 * Releases manager and participant locks of the Session and returns the Session to the pool.
+	 * If SessionGUID is not provided, the Session currently owned by the manager is released.
 	 * Server-only.
 	 */
 	void ReleaseDialogueLock(UMounteaDialogueManager* Manager, const FGuid& SessionGUID = FGuid());
 
+	/**
+	 * Returns true if Nodes of the Graph must be replicated to the connection by GUID,
+	 * because the client reported its copy of the Graph does not match the server one.
+	 */
+	bool IsGuidAddressingRequired(const UNetConnection* Connection, const FGuid& GraphGUID) const;
+
+	// Server-only. Switches Node references of the Graph to GUID addressing for the connection.
+	void MarkGuidAddressingRequired(const UNetConnection* Connection, const FGuid& GraphGUID);
+
+	/**
+	 * Returns true if Dialogue Rows of the Data Table must be replicated to the connection in full,
+	 * because the client could not resolve them from its row cache.
+	 */
+	bool IsFullRowRequired(const UNetConnection* Connection, const UDataTable* Table) const;
+
+	// Server-only. Stops sending Data Table handles of the Data Table rows to the connection.
+	void MarkFullRowRequired(const UNetConnection* Connection, const UDataTable* Table);
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	// Keeps stats of a dialogue whose Session moved on, only the most recent MaxFinishedSessionStats are kept.
+	void ArchiveSessionStats(const FMounteaDialogueSessionStats& Stats);
+
+	/**
+	 * Returns stats of given dialogue, running or finished, null if they are not tracked anymore.
+	 * Server-only.
+	 */
+	FMounteaDialogueSessionStats* FindSessionStats(const FGuid& SessionGUID);
+
+	/**
+	 * Logs stats of running and recently finished dialogues.
+	 * Server-only, used by the 'Mountea.Dialogue.SessionStats' console command.
+	 *
+	 * @param bWriteCsv  Also writes the stats into a CSV file in the Profiling directory.
+	 */
+	void ReportSessionStats(const bool bWriteCsv);
+#endif
+
 private:
 
 	/**
@@ -129,7 +366,32 @@ private:
 		TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& OutAllParticipants,
 		TArray<FText>& OutErrors) const;
 
-	bool TryAcquireDialogueLock(UMounteaDialogueManager* Manager);
+	// Locks the manager for a new Session, fails if the manager already runs or starts a dialogue.
+	bool TryAcquireDialogueLock(UMounteaDialogueManager* Manager, const FGuid& SessionGUID);
+
+	// Locks participants for the Session, fails without locking anything if any of them is already locked.
+	bool TryLockParticipants(const FGuid& SessionGUID, TConstArrayView<const UObject*> Participants, FString& OutError);
+
+	// Returns a free pooled Session, creating a new Session component on the GameState if the pool is empty.
+	UMounteaDialogueSession* AcquirePooledSession();
+
+	void ReturnPooledSession(UMounteaDialogueSession* Session);
+
+	void ReleaseSessionLock(const FGuid& SessionGUID);
+
+	// Start pipeline stages, each looks the operation up again as it might have been cancelled meanwhile.
+	void StreamStartOperation(const FGuid& SessionGUID);
+	void OnStartOperationStreamed(FGuid SessionGUID);
+	void EvaluateStartOperation(const FGuid& SessionGUID);
+	void FinishStartOperation(const FGuid& SessionGUID, const EMounteaDialogueStartStage Result, const FString& Message);
+
+	const FGuid* FindStartOperationGUID(const UMounteaDialogueManager* Manager) const;
+
+	UFUNCTION()
+	void OnParticipantActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	// Drops per connection replication state of the leaving player, along with entries of connections already gone.
+	void OnPlayerLogout(AGameModeBase* GameMode, AController* Exiting);
 
 private:
 
@@ -141,16 +403,57 @@ private:
 
 	/**
 	 * All active dialogue sessions in the current world.
+	 * Source of truth for running dialogues on the server.
 	 */
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UMounteaDialogueSession>> ActiveSessions;
 
+	/**
+	 * All Session components which have begun play, on both server and clients.
+	 */
 	UPROPERTY(Transient)
-	TWeakObjectPtr<UMounteaDialogueManager> ActiveManager;
+	TArray<TObjectPtr<UMounteaDialogueSession>> RegisteredSessions;
 
+	/**
+	 * Server Sessions which are not running any dialogue.
+	 */
 	UPROPERTY(Transient)
-	FGuid ActiveSessionGUID;
+	TArray<TObjectPtr<UMounteaDialogueSession>> SessionPool;
+
+	// Locks of running and starting dialogues, keyed by Session GUID.
+	TMap<FGuid, FMounteaDialogueSessionLock> SessionLocks;
+
+	TMap<TObjectKey<UMounteaDialogueManager>, FGuid> ManagerLocks;
+
+	TMap<TObjectKey<UObject>, FGuid> ParticipantLocks;
+
+	// Resolved participants keyed by their actor, see ResolveCachedParticipant.
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<UObject>> ParticipantCache;
+
+	// Graphs each connection cannot address by Node index.
+	TMap<TObjectKey<UNetConnection>, TSet<FGuid>> GuidAddressedGraphs;
+
+	// Data Tables each connection cannot resolve rows of.
+	TMap<TObjectKey<UNetConnection>, TSet<TObjectKey<UDataTable>>> FullRowTables;
 
+	FDelegateHandle PlayerLogoutHandle;
+
+	FMounteaDialogueTimingWheel DialogueTimers;
+
+#if MOUNTEA_DIALOGUE_WITH_SESSION_STATS
+	static constexpr int32 MaxFinishedSessionStats = 128;
+
+	// Stats of finished dialogues, oldest first.
+	TArray<FMounteaDialogueSessionStats> FinishedSessionStats;
+#endif
+
+	/**
+	 * Start requests which have not been committed yet, keyed by their future Session GUID.
+	 */
 	UPROPERTY(Transient)
-	bool bDialogueLockActive = false;
+	TMap<FGuid, FMounteaDialogueStartOperation> PendingStartOperations;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FMounteaDialogueSessionScaleTest;
+#endif
 };
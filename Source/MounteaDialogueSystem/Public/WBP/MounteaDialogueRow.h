@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Data/MounteaDialogueTimingWheel.h"
 #include "Interfaces/HUD/MounteaDialogueUIBaseInterface.h"
 #include "Interfaces/UMG/MounteaDialogueRowInterface.h"
 #include "MounteaDialogueRow.generated.h"
@@ -47,12 +48,14 @@ protected:
 protected:
 
 	// Timer Handle responsible for the whole Duration of the effect
+	// ❔ Dialogue timer, query or clear it with UMounteaDialogueTimerStatics
 	UPROPERTY(BlueprintReadOnly, Category="Mountea|Dialogue")
-	FTimerHandle TimerHandle_TypeWriterDuration;
+	FMounteaDialogueTimerHandle TimerHandle_TypeWriterDuration;
 
 	// Timer Handle responsible for each character update
+	// ❔ Dialogue timer, query or clear it with UMounteaDialogueTimerStatics
 	UPROPERTY(BlueprintReadOnly, Category="Mountea|Dialogue")
-	FTimerHandle TimerHandle_TypeWriterUpdateInterval;
+	FMounteaDialogueTimerHandle TimerHandle_TypeWriterUpdateInterval;
 
 protected:
 	
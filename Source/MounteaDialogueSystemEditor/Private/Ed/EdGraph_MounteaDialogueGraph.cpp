@@ -255,8 +255,15 @@ void UEdGraph_MounteaDialogueGraph::RebuildMounteaDialogueGraph()
 		return EdNode_LNode->NodePosX < EdNode_RNode->NodePosX;
 	});
 
+	// Runtime traversal reads ChildEdges, they have to follow the rebuilt ChildrenNodes and Edges
+	for (UMounteaDialogueGraphNode* dialogueNode : dialogueGraph->AllNodes)
+		dialogueNode->RebuildChildEdges();
+
 	AssignExecutionOrder();
 
+	dialogueGraph->RebuildNodeIndex();
+	dialogueGraph->InvalidateCompiledGraph();
+
 	bSuppressDeltaSync = false;
 }
 
@@ -324,6 +331,7 @@ void UEdGraph_MounteaDialogueGraph::Clear()
 			UMounteaDialogueGraphNode* MounteaDialogueGraphNode = EdNode->DialogueGraphNode;
 			MounteaDialogueGraphNode->ParentNodes.Reset();
 			MounteaDialogueGraphNode->ChildrenNodes.Reset();
+			MounteaDialogueGraphNode->ChildEdges.Reset();
 			MounteaDialogueGraphNode->Edges.Reset();
 		}
 	}
@@ -351,6 +359,7 @@ void UEdGraph_MounteaDialogueGraph::SortNodes(UMounteaDialogueGraphNode* RootNod
 
 			Node->ChildrenNodes.Sort(Comp);
 			Node->ParentNodes.Sort(Comp);
+			Node->RebuildChildEdges();
 
 			for (int j = 0; j < Node->ChildrenNodes.Num(); ++j)
 			{
@@ -443,6 +452,9 @@ void UEdGraph_MounteaDialogueGraph::AssignExecutionOrder()
 				Node->ExecutionOrder = INDEX_NONE;
 		}
 	}
+
+	// Topology or Execution Order changed, compiled data no longer match
+	Graph->InvalidateCompiledGraph();
 }
 
 void UEdGraph_MounteaDialogueGraph::AssignNodeToLayer(UMounteaDialogueGraphNode* Node, int32 LayerIndex, TMap<int32, TArray<UMounteaDialogueGraphNode*>>& LayeredNodes)
@@ -546,8 +558,15 @@ void UEdGraph_MounteaDialogueGraph::SyncTopology()
 		return EdNode_LNode->NodePosX < EdNode_RNode->NodePosX;
 	});
 
+	// Runtime traversal reads ChildEdges, they have to follow the rebuilt ChildrenNodes and Edges
+	for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+		Node->RebuildChildEdges();
+
 	AssignExecutionOrder();
 
+	Graph->RebuildNodeIndex();
+	Graph->InvalidateCompiledGraph();
+
 	bSuppressDeltaSync = false;
 }
 
@@ -606,6 +625,8 @@ void UEdGraph_MounteaDialogueGraph::RegisterNode(UEdNode_MounteaDialogueGraphNod
 	node->Graph = Graph;
 	node->Rename(nullptr, Graph, REN_DontCreateRedirectors | REN_DoNotDirty);
 
+	Graph->RebuildNodeIndex();
+
 	if (node->ParentNodes.Num() == 0)
 	{
 		Graph->RootNodes.AddUnique(node);
@@ -632,6 +653,7 @@ void UEdGraph_MounteaDialogueGraph::UnregisterNode(UMounteaDialogueGraphNode* No
 	{
 		parent->ChildrenNodes.Remove(Node);
 		parent->Edges.Remove(Node);
+		parent->RebuildChildEdges();
 	}
 
 	for (UMounteaDialogueGraphNode* child : Node->ChildrenNodes)
@@ -650,11 +672,13 @@ void UEdGraph_MounteaDialogueGraph::UnregisterNode(UMounteaDialogueGraphNode* No
 
 	Node->ParentNodes.Reset();
 	Node->ChildrenNodes.Reset();
+	Node->ChildEdges.Reset();
 	Node->Edges.Reset();
 
 	NodeMap.Remove(Node);
 	Graph->AllNodes.Remove(Node);
 	Graph->RootNodes.Remove(Node);
+	Graph->RebuildNodeIndex();
 
 	Graph->RootNodes.Sort([&](const UMounteaDialogueGraphNode& L, const UMounteaDialogueGraphNode& R)
 	{
@@ -695,6 +719,7 @@ void UEdGraph_MounteaDialogueGraph::RegisterEdge(UEdNode_MounteaDialogueGraphEdg
 
 	Edge->StartNode->ChildrenNodes.AddUnique(Edge->EndNode);
 	Edge->EndNode->ParentNodes.AddUnique(Edge->StartNode);
+	Edge->StartNode->RebuildChildEdges();
 
 	Graph->RootNodes.Remove(Edge->EndNode);
 
@@ -717,6 +742,7 @@ void UEdGraph_MounteaDialogueGraph::UnregisterEdge(UMounteaDialogueGraphEdge* Ed
 	Edge->StartNode->ChildrenNodes.Remove(Edge->EndNode);
 	Edge->EndNode->ParentNodes.Remove(Edge->StartNode);
 	Edge->StartNode->Edges.Remove(Edge->EndNode);
+	Edge->StartNode->RebuildChildEdges();
 
 	if (Edge->EndNode->ParentNodes.Num() == 0)
 	{
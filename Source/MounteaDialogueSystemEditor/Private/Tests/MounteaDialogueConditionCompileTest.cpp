@@ -0,0 +1,193 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Helpers/MounteaDialogueConditionsStatics.h"
+#include "K2Node_CallParentFunction.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "MounteaDialogueTestConditions.h"
+
+namespace MounteaDialogueConditionCompileTest
+{
+	/**
+	 * Blueprint subclass of the recording condition overriding EvaluateCondition with a Parent call,
+	 * so it is evaluated through the Blueprint VM while still recording its evaluation.
+	 */
+	UClass* CreateBlueprintConditionClass(FAutomationTestBase& Test)
+	{
+		UBlueprint* blueprint = FKismetEditorUtilities::CreateBlueprint(
+			UMounteaDialogueTestRecordingCondition::StaticClass(),
+			GetTransientPackage(),
+			MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_MounteaDialogueTestCondition")),
+			BPTYPE_Normal,
+			UBlueprint::StaticClass(),
+			UBlueprintGeneratedClass::StaticClass());
+		if (!Test.TestNotNull(TEXT("Blueprint condition"), blueprint))
+			return nullptr;
+
+		const FName evaluateConditionName = GET_FUNCTION_NAME_CHECKED(UMounteaDialogueConditionBase, EvaluateCondition);
+		UFunction* evaluateFunction = UMounteaDialogueConditionBase::StaticClass()->FindFunctionByName(evaluateConditionName);
+
+		UEdGraph* functionGraph = FBlueprintEditorUtils::CreateNewGraph(blueprint, evaluateConditionName, UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+		FBlueprintEditorUtils::AddFunctionGraph<UClass>(blueprint, functionGraph, false, UMounteaDialogueConditionBase::StaticClass());
+
+		TArray<UK2Node_FunctionEntry*> entryNodes;
+		TArray<UK2Node_FunctionResult*> resultNodes;
+		TArray<UK2Node_CallParentFunction*> parentNodes;
+		functionGraph->GetNodesOfClass(entryNodes);
+		functionGraph->GetNodesOfClass(resultNodes);
+		functionGraph->GetNodesOfClass(parentNodes);
+		if (!Test.TestTrue(TEXT("Override has entry and result nodes"), entryNodes.Num() == 1 && resultNodes.Num() == 1))
+			return nullptr;
+
+		UK2Node_CallParentFunction* parentNode = parentNodes.Num() > 0 ? parentNodes[0] : nullptr;
+		if (!parentNode)
+		{
+			FGraphNodeCreator<UK2Node_CallParentFunction> nodeCreator(*functionGraph);
+			parentNode = nodeCreator.CreateNode();
+			parentNode->SetFromFunction(evaluateFunction);
+			nodeCreator.Finalize();
+		}
+
+		const UEdGraphSchema_K2* schema = GetDefault<UEdGraphSchema_K2>();
+		UK2Node_FunctionEntry* entryNode = entryNodes[0];
+		UK2Node_FunctionResult* resultNode = resultNodes[0];
+		// Override graph might already call its Parent, pins linked by the editor are kept
+		auto linkPins = [schema](UEdGraphPin* From, UEdGraphPin* To)
+		{
+			return From && To && (From->LinkedTo.Contains(To) || schema->TryCreateConnection(From, To));
+		};
+		bool bLinked = linkPins(schema->FindExecutionPin(*entryNode, EGPD_Output), parentNode->GetExecPin());
+		bLinked &= linkPins(parentNode->GetThenPin(), schema->FindExecutionPin(*resultNode, EGPD_Input));
+		bLinked &= linkPins(entryNode->FindPin(TEXT("Context")), parentNode->FindPin(TEXT("Context")));
+		bLinked &= linkPins(parentNode->GetReturnValuePin(), resultNode->FindPin(UEdGraphSchema_K2::PN_ReturnValue));
+		if (!Test.TestTrue(TEXT("Override calls its Parent"), bLinked))
+			return nullptr;
+
+		FKismetEditorUtilities::CompileBlueprint(blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		if (!Test.TestTrue(TEXT("Blueprint condition compiled"), blueprint->Status != BS_Error && blueprint->GeneratedClass != nullptr))
+			return nullptr;
+
+		return blueprint->GeneratedClass;
+	}
+
+	FMounteaDialogueCondition MakeRule(UMounteaDialogueTestRecordingCondition* Condition, const bool bNegate)
+	{
+		FMounteaDialogueCondition rule;
+		rule.ConditionClass = Condition;
+		rule.bNegate = bNegate;
+		return rule;
+	}
+
+	FString DescribeLog()
+	{
+		TArray<FString> names;
+		for (const UMounteaDialogueTestRecordingCondition* condition : UMounteaDialogueTestRecordingCondition::EvaluationLog)
+			names.Add(condition->ConditionName.ToString());
+		return FString::Join(names, TEXT(", "));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueConditionCompileTest, "MounteaDialogue.Conditions.CompiledMatchesInterpreted",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMounteaDialogueConditionCompileTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueConditionCompileTest;
+
+	UClass* blueprintClass = CreateBlueprintConditionClass(*this);
+	if (!blueprintClass)
+		return false;
+
+	UMounteaDialogueTestRecordingCondition* blueprintCondition = NewObject<UMounteaDialogueTestRecordingCondition>(GetTransientPackage(), blueprintClass);
+	UMounteaDialogueTestRecordingCondition* nativeCondition = NewObject<UMounteaDialogueTestRecordingCondition>(GetTransientPackage());
+	UMounteaDialogueTestRecordingCondition* negatedCondition = NewObject<UMounteaDialogueTestRecordingCondition>(GetTransientPackage());
+	blueprintCondition->ConditionName = TEXT("Blueprint");
+	nativeCondition->ConditionName = TEXT("Native");
+	negatedCondition->ConditionName = TEXT("NegatedNative");
+	TestFalse(TEXT("Blueprint condition goes through the Blueprint VM"), blueprintCondition->HasNativeEvaluation());
+	TestTrue(TEXT("Native condition is evaluated natively"), nativeCondition->HasNativeEvaluation());
+
+	// Blueprint first, so native first ordering has something to move
+	const TArray<FMounteaDialogueCondition> rules = {
+		MakeRule(blueprintCondition, false),
+		MakeRule(nativeCondition, false),
+		MakeRule(negatedCondition, true)
+	};
+
+	// Without a Context nothing is cached, every evaluation reaches the condition
+	const TScriptInterface<IMounteaDialogueConditionContextInterface> noContext;
+	TArray<const UMounteaDialogueTestRecordingCondition*>& evaluationLog = UMounteaDialogueTestRecordingCondition::EvaluationLog;
+
+	for (const EMounteaDialogueConditionCaching caching : { EMounteaDialogueConditionCaching::Never, EMounteaDialogueConditionCaching::Pure })
+	{
+		blueprintCondition->Caching = caching;
+		const bool bPure = caching == EMounteaDialogueConditionCaching::Pure;
+
+		TArray<FMounteaDialogueConditionOp> ops;
+		UMounteaDialogueConditionsStatics::CompileConditionRules(rules, ops);
+		TestEqual(TEXT("One step per rule"), ops.Num(), rules.Num());
+		TestTrue(FString::Printf(TEXT("%s Blueprint condition is %s"), bPure ? TEXT("Pure") : TEXT("Impure"), bPure ? TEXT("moved last") : TEXT("kept first")),
+			ops.Num() == rules.Num() && (ops[0].Condition == blueprintCondition) != bPure);
+
+		// Interpreting the rules in step order must match the compiled run exactly, short-circuit included
+		TArray<FMounteaDialogueCondition> stepRules;
+		for (const FMounteaDialogueConditionOp& op : ops)
+			stepRules.Add(MakeRule(Cast<UMounteaDialogueTestRecordingCondition>(op.Condition), op.bNegate));
+
+		for (const EConditionEvaluationMode mode : { EConditionEvaluationMode::All, EConditionEvaluationMode::Any })
+		{
+			for (int32 resultMask = 0; resultMask < 8; ++resultMask)
+			{
+				blueprintCondition->bResult = (resultMask & 1) != 0;
+				nativeCondition->bResult = (resultMask & 2) != 0;
+				negatedCondition->bResult = (resultMask & 4) != 0;
+				const FString scenario = FString::Printf(TEXT("%s, %s, results %d"),
+					bPure ? TEXT("Pure") : TEXT("Never"), mode == EConditionEvaluationMode::All ? TEXT("All") : TEXT("Any"), resultMask);
+
+				evaluationLog.Reset();
+				const bool bAuthored = UMounteaDialogueConditionsStatics::EvaluateConditionRules(rules, mode, noContext);
+				const FString authoredLog = DescribeLog();
+
+				evaluationLog.Reset();
+				const bool bStepOrder = UMounteaDialogueConditionsStatics::EvaluateConditionRules(stepRules, mode, noContext);
+				const FString stepOrderLog = DescribeLog();
+
+				evaluationLog.Reset();
+				const bool bCompiled = UMounteaDialogueConditionsStatics::EvaluateConditionOps(ops, mode, noContext);
+				const FString compiledLog = DescribeLog();
+
+				TestEqual(FString::Printf(TEXT("%s: compiled result matches authored rules"), *scenario), bCompiled, bAuthored);
+				TestEqual(FString::Printf(TEXT("%s: compiled evaluation order matches its steps"), *scenario), compiledLog, stepOrderLog);
+				TestEqual(FString::Printf(TEXT("%s: step order result matches"), *scenario), bStepOrder, bAuthored);
+				// Only Pure Blueprint conditions may be skipped or delayed by compilation
+				if (!bPure)
+					TestEqual(FString::Printf(TEXT("%s: compiled evaluation order matches authored rules"), *scenario), compiledLog, authoredLog);
+			}
+		}
+	}
+
+	evaluationLog.Reset();
+	return true;
+}
+
+#endif
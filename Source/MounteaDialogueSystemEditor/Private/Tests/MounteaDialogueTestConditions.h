@@ -0,0 +1,40 @@
+// Copyright (C) 2026 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Conditions/MounteaDialogueConditionBase.h"
+#include "MounteaDialogueTestConditions.generated.h"
+
+/**
+ * Condition of the Mountea Dialogue automation tests, returns bResult and records every evaluation.
+ * Blueprint subclasses overriding EvaluateCondition with a Parent call are recorded too, through the Blueprint VM.
+ */
+UCLASS(HideDropdown)
+class UMounteaDialogueTestRecordingCondition : public UMounteaDialogueConditionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual bool EvaluateCondition_Implementation(const TScriptInterface<IMounteaDialogueConditionContextInterface>& Context) const override
+	{
+		EvaluationLog.Add(this);
+		return bResult;
+	};
+
+	bool bResult = true;
+
+	// Conditions in the order they were evaluated, reset by the test.
+	static inline TArray<const UMounteaDialogueTestRecordingCondition*> EvaluationLog;
+};